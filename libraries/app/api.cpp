@@ -44,6 +44,8 @@
 #include <graphene/utilities/git_revision.hpp>
 #include <fc/git_revision.hpp>
 
+#include <sstream>
+
 namespace scorum {
 namespace app {
 
@@ -360,5 +362,100 @@ void network_node_api::set_advanced_node_parameters(const fc::variant_object& pa
 {
     return _app.p2p_node()->set_advanced_node_parameters(params);
 }
+
+node_metrics_api::node_metrics_api(const api_context& a)
+    : _app(a.app)
+{
+}
+
+void node_metrics_api::on_api_startup()
+{
+}
+
+std::vector<api_method_stats> node_metrics_api::get_api_stats() const
+{
+    return _app.get_api_metrics().get_stats();
+}
+
+database_lock_stats node_metrics_api::get_database_lock_stats() const
+{
+    const auto& db = *_app.chain_database();
+
+    database_lock_stats result;
+    result.read_locks = db.read_locks_taken();
+    result.read_lock_wait_us = db.read_lock_wait_microseconds();
+    result.write_locks = db.write_locks_taken();
+    result.write_lock_wait_us = db.write_lock_wait_microseconds();
+    return result;
+}
+
+namespace {
+std::string peer_label(const graphene::net::peer_statistics& peer)
+{
+    return peer.host ? std::string(*peer.host) : std::string("unknown");
+}
+}
+
+graphene::net::node_statistics node_metrics_api::get_p2p_statistics() const
+{
+    FC_ASSERT(_app.p2p_node(), "P2P node is not running");
+
+    return _app.p2p_node()->get_statistics();
+}
+
+std::string node_metrics_api::get_prometheus_metrics() const
+{
+    const database_lock_stats locks = get_database_lock_stats();
+
+    std::ostringstream out;
+
+    out << to_prometheus_text(get_api_stats());
+
+    out << "# HELP scorum_database_locks_total Chain database locks taken by the node.\n";
+    out << "# TYPE scorum_database_locks_total counter\n";
+    out << "scorum_database_locks_total{lock=\"read\"} " << locks.read_locks << "\n";
+    out << "scorum_database_locks_total{lock=\"write\"} " << locks.write_locks << "\n";
+
+    out << "# HELP scorum_database_lock_wait_seconds_total Time the node waited for the chain database locks.\n";
+    out << "# TYPE scorum_database_lock_wait_seconds_total counter\n";
+    out << "scorum_database_lock_wait_seconds_total{lock=\"read\"} " << locks.read_lock_wait_us / 1e6 << "\n";
+    out << "scorum_database_lock_wait_seconds_total{lock=\"write\"} " << locks.write_lock_wait_us / 1e6 << "\n";
+
+    if (_app.p2p_node())
+    {
+        const graphene::net::node_statistics p2p = get_p2p_statistics();
+
+        out << "# HELP scorum_p2p_peers Connected peers.\n";
+        out << "# TYPE scorum_p2p_peers gauge\n";
+        out << "scorum_p2p_peers " << p2p.peers.size() << "\n";
+
+        out << "# HELP scorum_p2p_bytes_per_second Average network usage of the last minute.\n";
+        out << "# TYPE scorum_p2p_bytes_per_second gauge\n";
+        out << "scorum_p2p_bytes_per_second{direction=\"upload\"} " << p2p.upload_bytes_per_second << "\n";
+        out << "scorum_p2p_bytes_per_second{direction=\"download\"} " << p2p.download_bytes_per_second << "\n";
+
+        out << "# HELP scorum_p2p_peer_send_queue_bytes Size of messages waiting to be sent to the peer.\n";
+        out << "# TYPE scorum_p2p_peer_send_queue_bytes gauge\n";
+        for (const graphene::net::peer_statistics& peer : p2p.peers)
+        {
+            out << "scorum_p2p_peer_send_queue_bytes{peer=\"" << peer_label(peer) << "\"} "
+                << peer.send_queue_bytes << "\n";
+        }
+
+        out << "# HELP scorum_p2p_peer_round_trip_seconds Round trip delay measured on connection to the peer.\n";
+        out << "# TYPE scorum_p2p_peer_round_trip_seconds gauge\n";
+        for (const graphene::net::peer_statistics& peer : p2p.peers)
+        {
+            out << "scorum_p2p_peer_round_trip_seconds{peer=\"" << peer_label(peer) << "\"} "
+                << peer.round_trip_delay_us / 1e6 << "\n";
+        }
+
+        out << "# HELP scorum_p2p_sync_unfetched_items Blocks still to fetch while syncing.\n";
+        out << "# TYPE scorum_p2p_sync_unfetched_items gauge\n";
+        out << "scorum_p2p_sync_unfetched_items " << p2p.sync.unfetched_items << "\n";
+    }
+
+    return out.str();
+}
 }
 } // scorum::app
@@ -0,0 +1,146 @@
+#include <scorum/app/api_metrics.hpp>
+
+#include <algorithm>
+#include <sstream>
+
+namespace scorum {
+namespace app {
+
+namespace {
+
+// method names come from requests, so the number of tracked methods is bounded
+const size_t max_tracked_methods = 1000;
+const char* const untracked_name = "other";
+
+std::string escape_label(const std::string& value)
+{
+    std::string result;
+    result.reserve(value.size());
+
+    for (char c : value)
+    {
+        if (c == '\\' || c == '"')
+            result.push_back('\\');
+        if (c == '\n')
+            result += "\\n";
+        else
+            result.push_back(c);
+    }
+
+    return result;
+}
+
+std::string labels(const api_method_stats& stats)
+{
+    return "api=\"" + escape_label(stats.api) + "\",method=\"" + escape_label(stats.method) + "\"";
+}
+}
+
+const std::array<uint64_t, 10> api_metrics::latency_buckets_us
+    = { { 1000, 5000, 10000, 25000, 50000, 100000, 250000, 500000, 1000000, 5000000 } };
+
+void api_metrics::record_call(const std::string& api,
+                              const std::string& method,
+                              const fc::microseconds& latency,
+                              uint64_t response_size)
+{
+    const uint64_t latency_us = std::max<int64_t>(latency.count(), 0);
+
+    const size_t bucket = std::lower_bound(latency_buckets_us.begin(), latency_buckets_us.end(), latency_us)
+        - latency_buckets_us.begin();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    api_method_stats& stats = get(api, method);
+
+    ++stats.calls;
+    stats.total_latency_us += latency_us;
+    stats.max_latency_us = std::max(stats.max_latency_us, latency_us);
+    ++stats.latency_buckets[bucket];
+    stats.response_bytes += response_size;
+}
+
+void api_metrics::record_read_lock_wait(const std::string& api, const std::string& method, uint64_t wait_us)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    get(api, method).read_lock_wait_us += wait_us;
+}
+
+std::vector<api_method_stats> api_metrics::get_stats() const
+{
+    std::vector<api_method_stats> result;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    result.reserve(_stats.size());
+    for (const auto& stats : _stats)
+        result.push_back(stats.second);
+
+    return result;
+}
+
+api_method_stats& api_metrics::get(const std::string& api, const std::string& method)
+{
+    auto key = std::make_pair(api, method);
+
+    auto itr = _stats.find(key);
+    if (itr == _stats.end() && _stats.size() >= max_tracked_methods)
+    {
+        key = std::make_pair(std::string(untracked_name), std::string(untracked_name));
+        itr = _stats.find(key);
+    }
+
+    if (itr == _stats.end())
+    {
+        api_method_stats stats;
+        stats.api = key.first;
+        stats.method = key.second;
+        stats.latency_buckets.resize(latency_buckets_us.size() + 1);
+
+        itr = _stats.emplace(key, std::move(stats)).first;
+    }
+
+    return itr->second;
+}
+
+std::string to_prometheus_text(const std::vector<api_method_stats>& stats)
+{
+    std::ostringstream out;
+
+    out << "# HELP scorum_api_call_duration_seconds Latency of API calls.\n";
+    out << "# TYPE scorum_api_call_duration_seconds histogram\n";
+    for (const api_method_stats& s : stats)
+    {
+        const std::string l = labels(s);
+
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i < api_metrics::latency_buckets_us.size(); ++i)
+        {
+            cumulative += s.latency_buckets[i];
+            out << "scorum_api_call_duration_seconds_bucket{" << l << ",le=\""
+                << api_metrics::latency_buckets_us[i] / 1e6 << "\"} " << cumulative << "\n";
+        }
+        out << "scorum_api_call_duration_seconds_bucket{" << l << ",le=\"+Inf\"} " << s.calls << "\n";
+        out << "scorum_api_call_duration_seconds_sum{" << l << "} " << s.total_latency_us / 1e6 << "\n";
+        out << "scorum_api_call_duration_seconds_count{" << l << "} " << s.calls << "\n";
+    }
+
+    out << "# HELP scorum_api_response_bytes_total Size of API responses.\n";
+    out << "# TYPE scorum_api_response_bytes_total counter\n";
+    for (const api_method_stats& s : stats)
+    {
+        out << "scorum_api_response_bytes_total{" << labels(s) << "} " << s.response_bytes << "\n";
+    }
+
+    out << "# HELP scorum_api_read_lock_wait_seconds_total Time API calls waited for the chain database read lock.\n";
+    out << "# TYPE scorum_api_read_lock_wait_seconds_total counter\n";
+    for (const api_method_stats& s : stats)
+    {
+        out << "scorum_api_read_lock_wait_seconds_total{" << labels(s) << "} " << s.read_lock_wait_us / 1e6 << "\n";
+    }
+
+    return out.str();
+}
+}
+}
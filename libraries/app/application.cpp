@@ -26,7 +26,9 @@
 #include <scorum/app/chain_api.hpp>
 #include <scorum/app/api_access.hpp>
 #include <scorum/app/application.hpp>
+#include <scorum/app/binary_api_server.hpp>
 #include <scorum/app/plugin.hpp>
+#include <scorum/app/rpc_executor.hpp>
 #include <scorum/account_statistics/account_statistics_api.hpp>
 #include <scorum/account_statistics/account_statistics_plugin.hpp>
 #include <scorum/blockchain_history/account_history_api.hpp>
@@ -39,6 +41,7 @@
 #include <scorum/chain/schema/scorum_object_types.hpp>
 #include <scorum/chain/database_exceptions.hpp>
 #include <scorum/chain/genesis/genesis_state.hpp>
+#include <scorum/chain/genesis/genesis_binary.hpp>
 #include <scorum/egenesis/egenesis.hpp>
 
 #include <fc/time.hpp>
@@ -57,6 +60,8 @@
 #include <fc/rpc/websocket_api.hpp>
 #include <fc/network/resolve.hpp>
 #include <fc/string.hpp>
+#include <fc/thread/mutex.hpp>
+#include <fc/thread/scoped_lock.hpp>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/filesystem/path.hpp>
@@ -64,6 +69,7 @@
 #include <boost/range/algorithm/reverse.hpp>
 
 #include <iostream>
+#include <mutex>
 #include <set>
 
 #include <fc/log/file_appender.hpp>
@@ -97,6 +103,83 @@ api_context::api_context(application& _app, const std::string& _api_name, std::w
 
 namespace detail {
 
+/**
+ * Websocket connection which can execute calls of pooled APIs on rpc_executor. Calls of a connection are still
+ * executed one by one in the order they come, the pool executes calls of different connections at the same time.
+ */
+class pooled_websocket_api_connection : public fc::rpc::websocket_api_connection
+{
+public:
+    explicit pooled_websocket_api_connection(fc::http::websocket_connection& c)
+        : fc::rpc::websocket_api_connection(c)
+    {
+    }
+
+    void register_named_api(const std::string& name, const fc::api_ptr& api)
+    {
+        _api_names[api->register_api(*this)] = name;
+    }
+
+    std::string call(const std::string& message, bool send_message)
+    {
+        return on_message(message, send_message);
+    }
+
+    void send_reply(const std::string& reply)
+    {
+        _connection.send_message(reply);
+    }
+
+    fc::mutex& calls_mutex()
+    {
+        return _calls_mutex;
+    }
+
+    /// API and method of the "call" request, empty for other requests
+    std::pair<std::string, std::string> get_call(const std::string& message) const
+    {
+        std::pair<std::string, std::string> result;
+
+        try
+        {
+            const fc::variant request = fc::json::from_string(message);
+            const fc::variant_object& request_obj = request.get_object();
+
+            if (!request_obj.contains("method") || request_obj["method"].as_string() != "call"
+                || !request_obj.contains("params"))
+                return result;
+
+            const fc::variants& params = request_obj["params"].get_array();
+            if (params.size() < 2 || !params[1].is_string())
+                return result;
+
+            if (params[0].is_string())
+            {
+                result.first = params[0].as_string();
+            }
+            else if (params[0].is_numeric())
+            {
+                auto itr = _api_names.find(params[0].as_uint64());
+                if (itr != _api_names.end())
+                    result.first = itr->second;
+            }
+
+            if (!result.first.empty())
+                result.second = params[1].as_string();
+        }
+        catch (const fc::exception&)
+        {
+            // malformed requests are left to the connection to reply with the error
+        }
+
+        return result;
+    }
+
+private:
+    std::map<uint64_t, std::string> _api_names;
+    fc::mutex _calls_mutex;
+};
+
 using plugins_type = std::map<std::string, std::shared_ptr<abstract_plugin>>;
 using plugin_names_type = std::set<std::string>;
 
@@ -254,10 +337,32 @@ public:
         FC_CAPTURE_AND_RETHROW()
     }
 
+    void reset_binary_api_server()
+    {
+        try
+        {
+            if (!_options->count("rpc-binary-endpoint"))
+            {
+                return;
+            }
+
+            auto rpc_binary_endpoint = _options->at("rpc-binary-endpoint").as<std::string>();
+            ilog("Configured binary rpc to listen on ${ip}", ("ip", rpc_binary_endpoint));
+            auto endpoints = resolve_string_to_ip_endpoints(rpc_binary_endpoint);
+            FC_ASSERT(endpoints.size(), "rpc-binary-endpoint ${hostname} did not resolve",
+                      ("hostname", rpc_binary_endpoint));
+
+            _binary_api_server.reset(new binary_api_server(*_self, _public_apis, _rpc_executor.get()));
+            _binary_api_server->listen(endpoints[0]);
+        }
+        FC_CAPTURE_AND_RETHROW()
+    }
+
     void on_connection(const fc::http::websocket_connection_ptr& c)
     {
         std::shared_ptr<api_session_data> session = std::make_shared<api_session_data>();
-        session->wsc = std::make_shared<fc::rpc::websocket_api_connection>(*c);
+        auto wsc = std::make_shared<pooled_websocket_api_connection>(*c);
+        session->wsc = wsc;
 
         for (const std::string& name : _public_apis)
         {
@@ -269,11 +374,100 @@ public:
                 continue;
             }
             session->api_map[name] = api;
-            api->register_api(*session->wsc);
+            wsc->register_named_api(name, api);
         }
+
+        // the connection owns the session, handlers must not
+        std::weak_ptr<api_session_data> weak_session = session;
+
+        c->on_message_handler([this, weak_session](const std::string& message) {
+            std::shared_ptr<api_session_data> session = weak_session.lock();
+            if (session)
+                on_api_message(session, message, true);
+        });
+        c->on_http_handler([this, weak_session](const std::string& message) {
+            std::shared_ptr<api_session_data> session = weak_session.lock();
+            return session ? on_api_message(session, message, false) : std::string();
+        });
+
         c->set_session_data(session);
     }
 
+    std::string
+    on_api_message(const std::shared_ptr<api_session_data>& session, const std::string& message, bool send_message)
+    {
+        auto wsc = std::static_pointer_cast<pooled_websocket_api_connection>(session->wsc);
+
+        // login_api registers APIs on the connection, so no other call of the connection may run at the same time
+        fc::scoped_lock<fc::mutex> lock(wsc->calls_mutex());
+
+        const auto call = wsc->get_call(message);
+        if (call.first.empty())
+            return wsc->call(message, send_message);
+
+        const fc::time_point start = fc::time_point::now();
+
+        std::string reply;
+        if (!_rpc_executor || !_rpc_executor->is_pooled(call.first))
+        {
+            reply = _api_metrics.measure_read_lock_wait<std::string>(
+                call.first, call.second, [&]() { return wsc->call(message, send_message); });
+        }
+        else
+        {
+            // the worker keeps the session alive even if the connection is closed meanwhile
+            reply = _rpc_executor->run<std::string>(call.first, [this, session, call, message]() {
+                auto connection = std::static_pointer_cast<pooled_websocket_api_connection>(session->wsc);
+                return _api_metrics.measure_read_lock_wait<std::string>(
+                    call.first, call.second, [&]() { return connection->call(message, false); });
+            });
+
+            if (send_message && !reply.empty())
+                wsc->send_reply(reply);
+        }
+
+        _api_metrics.record_call(call.first, call.second, fc::time_point::now() - start, reply.size());
+
+        return reply;
+    }
+
+    void reset_rpc_executor()
+    {
+        const uint32_t threads
+            = _options->count("rpc-worker-threads") ? _options->at("rpc-worker-threads").as<uint32_t>() : 0;
+        if (!threads || !_options->count("rpc-worker-api"))
+            return;
+
+        std::map<std::string, uint32_t> api_limits;
+        for (const std::string& arg : _options->at("rpc-worker-api").as<std::vector<std::string>>())
+        {
+            std::vector<std::string> specs;
+            boost::split(specs, arg, boost::is_any_of(" \t,"), boost::token_compress_on);
+            for (const std::string& spec : specs)
+            {
+                if (spec.empty())
+                    continue;
+
+                // api_name[:max_concurrent_calls]
+                const auto colon = spec.find(':');
+                const std::string name = spec.substr(0, colon);
+                const uint32_t limit
+                    = colon == std::string::npos ? 0 : boost::lexical_cast<uint32_t>(spec.substr(colon + 1));
+
+                // network APIs call the P2P node which must be used from its own thread
+                FC_ASSERT(name != "login_api" && name != "network_broadcast_api" && name != "network_node_api"
+                              && name != "node_metrics_api",
+                          "${name} can not be executed by RPC workers", ("name", name));
+
+                api_limits[name] = limit;
+                ilog("API ${name} is executed by RPC workers, limit ${limit}", ("name", name)("limit", limit));
+            }
+        }
+
+        _rpc_executor.reset(new rpc_executor(threads, api_limits));
+        ilog("Started ${n} RPC worker threads", ("n", threads));
+    }
+
     application_impl(application* self, std::shared_ptr<chain::database> chain_db)
         : _self(self)
         , _chain_db(std::move(chain_db))
@@ -291,6 +485,7 @@ public:
         _self->register_api_factory<chain_api>(API_CHAIN);
         _self->register_api_factory<network_node_api>("network_node_api");
         _self->register_api_factory<network_broadcast_api>("network_broadcast_api");
+        _self->register_api_factory<node_metrics_api>("node_metrics_api");
     }
 
     void compute_genesis_state(scorum::chain::genesis_state_type& genesis_state)
@@ -301,6 +496,12 @@ public:
         {
             fc::path genesis_json_filename = _options->at("genesis-json").as<boost::filesystem::path>();
 
+            if (scorum::chain::is_binary_genesis(genesis_json_filename))
+            {
+                scorum::chain::load_binary_genesis(genesis_json_filename, genesis_state);
+                return;
+            }
+
             fc::read_file_contents(genesis_json_filename, genesis_str);
         }
         else
@@ -357,6 +558,10 @@ public:
                 }
 
                 _chain_db->set_flush_interval(_options->at("flush").as<uint32_t>());
+                _chain_db->set_invariants_audit_interval(_options->at("invariants-audit-interval").as<uint32_t>());
+                _chain_db->set_shared_file_growth(
+                    fc::parse_size(_options->at("shared-file-grow-step").as<std::string>()),
+                    fc::parse_size(_options->at("shared-file-max-size").as<std::string>()));
 
                 flat_map<uint32_t, block_id_type> loaded_checkpoints;
                 if (_options->count("checkpoint"))
@@ -473,8 +678,10 @@ public:
                 reset_p2p_node(_data_dir);
             }
 
+            reset_rpc_executor();
             reset_websocket_server();
             reset_websocket_tls_server();
+            reset_binary_api_server();
         }
         FC_LOG_AND_RETHROW()
     }
@@ -515,6 +722,44 @@ public:
         return it->second(ctx);
     }
 
+    void register_binary_api(const std::string& name, std::function<binary_api_methods(const fc::api_ptr&)> factory)
+    {
+        _binary_api_factories_by_name[name] = factory;
+    }
+
+    binary_api_methods create_binary_api_by_name(const api_context& ctx)
+    {
+        auto it = _binary_api_factories_by_name.find(ctx.api_name);
+        if (it == _binary_api_factories_by_name.end())
+        {
+            return binary_api_methods();
+        }
+
+        fc::api_ptr api = create_api_by_name(ctx);
+        if (!api)
+        {
+            return binary_api_methods();
+        }
+
+        // binary methods call the API instance, the session keeps it alive
+        auto session = ctx.session.lock();
+        FC_ASSERT(session, "API session is closed.");
+        session->api_map[ctx.api_name] = api;
+
+        return it->second(api);
+    }
+
+    std::shared_ptr<void> get_shared_api_state(const std::string& name,
+                                               std::function<std::shared_ptr<void>()> factory)
+    {
+        std::lock_guard<std::mutex> lock(_shared_api_state_mutex);
+
+        auto& state = _shared_api_state[name];
+        if (!state)
+            state = factory();
+        return state;
+    }
+
     /**
      * If delegate has the item, the network has no need to fetch it.
      */
@@ -1079,14 +1324,20 @@ public:
     std::shared_ptr<graphene::net::node> _p2p_network;
     std::shared_ptr<fc::http::websocket_server> _websocket_server;
     std::shared_ptr<fc::http::websocket_tls_server> _websocket_tls_server;
+    std::unique_ptr<binary_api_server> _binary_api_server;
+    std::unique_ptr<rpc_executor> _rpc_executor;
+    api_metrics _api_metrics;
 
     // These plugins have API that push block to DB.
     // It is not expected for read-only mode
-    const plugin_names_type _plugins_locked_in_readonly_mode = { "witness", "debug_node" };
+    const plugin_names_type _plugins_locked_in_readonly_mode = { "witness", "debug_node", "block_info" };
 
     plugins_type _plugins_available;
     plugins_type _plugins_enabled;
     flat_map<std::string, std::function<fc::api_ptr(const api_context&)>> _api_factories_by_name;
+    flat_map<std::string, std::function<binary_api_methods(const fc::api_ptr&)>> _binary_api_factories_by_name;
+    flat_map<std::string, std::shared_ptr<void>> _shared_api_state;
+    std::mutex _shared_api_state_mutex;
     std::vector<std::string> _public_apis;
     int32_t _max_block_age = -1;
     uint64_t _shared_file_size;
@@ -1109,6 +1360,9 @@ application::application(std::shared_ptr<chain::database> db)
 
 application::~application()
 {
+    // binary API connections and RPC workers use the chain database
+    my->_binary_api_server.reset();
+    my->_rpc_executor.reset();
     if (my->_p2p_network)
     {
         my->_p2p_network->close();
@@ -1134,6 +1388,16 @@ void application::set_program_options(boost::program_options::options_descriptio
     default_apis.push_back(API_BLOCKCHAIN_STATISTICS);
     std::string str_default_apis = boost::algorithm::join(default_apis, " ");
 
+    std::vector<std::string> default_worker_apis;
+    default_worker_apis.push_back("database_api");
+    default_worker_apis.push_back(API_CHAIN);
+    default_worker_apis.push_back("tags_api");
+    default_worker_apis.push_back(API_ACCOUNT_HISTORY);
+    default_worker_apis.push_back(API_BLOCKCHAIN_HISTORY);
+    default_worker_apis.push_back(API_ACCOUNT_STATISTICS);
+    default_worker_apis.push_back(API_BLOCKCHAIN_STATISTICS);
+    std::string str_default_worker_apis = boost::algorithm::join(default_worker_apis, " ");
+
     std::vector<std::string> default_plugins;
     default_plugins.push_back(BLOCKCHAIN_HISTORY_PLUGIN_NAME);
     default_plugins.push_back("account_by_key");
@@ -1151,8 +1415,13 @@ void application::set_program_options(boost::program_options::options_descriptio
     ("data-dir,d", bpo::value<boost::filesystem::path>()->default_value("witness_node_data_dir"), "Directory containing databases, configuration file, etc.")
     ("shared-file-dir", bpo::value<std::string>(), "Location of the shared memory file. Defaults to data_dir/blockchain")
     ("shared-file-size", bpo::value<std::string>()->default_value("54G"), "Size of the shared memory file. Default: 54G")
+    ("shared-file-grow-step", bpo::value<std::string>()->default_value("4G"), "Grow the shared memory file by this size between blocks when free memory drops below the half of it, 0 to disable. Default: 4G")
+    ("shared-file-max-size", bpo::value<std::string>()->default_value("0"), "Do not grow the shared memory file above this size, 0 for no limit. Default: 0")
     ("rpc-endpoint", bpo::value<std::string>()->implicit_value("127.0.0.1:8090"), "Endpoint for websocket RPC to listen on")
     ("rpc-tls-endpoint", bpo::value<std::string>()->implicit_value("127.0.0.1:8089"), "Endpoint for TLS websocket RPC to listen on")
+    ("rpc-binary-endpoint", bpo::value<std::string>()->implicit_value("127.0.0.1:8091"), "Endpoint for binary RPC (fc::raw packed requests and responses over TCP) to listen on")
+    ("rpc-worker-threads", bpo::value<uint32_t>()->default_value(0), "Number of threads executing calls of rpc-worker-api APIs, 0 to execute all calls on the RPC server thread")
+    ("rpc-worker-api", bpo::value< std::vector<std::string> >()->composing()->default_value(default_worker_apis, str_default_worker_apis), "Read only API executed by RPC worker threads as api_name or api_name:max_concurrent_calls, may be specified multiple times")
     ("read-forward-rpc", bpo::value<std::string>(), "Endpoint to forward write API calls to for a read node")
     ("server-pem,p", bpo::value<std::string>()->implicit_value("server.pem"), "The TLS certificate file for this server")
     ("server-pem-password,P", bpo::value<std::string>()->implicit_value(""), "Password for this certificate")
@@ -1161,11 +1430,12 @@ void application::set_program_options(boost::program_options::options_descriptio
     ("enable-plugin", bpo::value< std::vector<std::string> >()->composing()->default_value(default_plugins, str_default_plugins), "Plugin(s) to enable, may be specified multiple times")
     ("max-block-age", bpo::value< int32_t >()->default_value(200), "Maximum age of head block when broadcasting tx via API")
     ("flush", bpo::value< uint32_t >()->default_value(100000), "Flush shared memory file to disk this many blocks")
-    ("genesis-json,g", bpo::value<boost::filesystem::path>(), "File to read genesis state from")
+    ("invariants-audit-interval", bpo::value< uint32_t >()->default_value(SCORUM_BLOCKS_PER_HOUR), "Check supply invariants scanning all balances every this many blocks, only balances changed by a block are checked for other blocks (0 - never scan)")
+    ("genesis-json,g", bpo::value<boost::filesystem::path>(), "File to read genesis state from (json or binary made by create_genesis)")
     ("replay-blockchain", "Rebuild object graph by replaying all blocks")
     ("resync-blockchain", "Delete all blocks and re-sync with network from scratch")
     ("force-validate", "Force validation of all transactions")
-    ("read-only", "Node will not connect to p2p network and can only read from the chain state")
+    ("read-only", "Node will not connect to p2p network and can only read from the chain state (it can be shared with a running write node)")
     ("check-locks", "Check correctness of chainbase locking")
     ("disable-get-block", "Disable get_block API call");
     command_line_options.add(configuration_file_options);
@@ -1357,11 +1627,33 @@ fc::api_ptr application::create_api_by_name(const api_context& ctx)
     return my->create_api_by_name(ctx);
 }
 
+void application::register_binary_api(const std::string& name,
+                                      std::function<binary_api_methods(const fc::api_ptr&)> factory)
+{
+    return my->register_binary_api(name, factory);
+}
+
+binary_api_methods application::create_binary_api_by_name(const api_context& ctx)
+{
+    return my->create_binary_api_by_name(ctx);
+}
+
+std::shared_ptr<void> application::get_shared_api_state(const std::string& name,
+                                                        std::function<std::shared_ptr<void>()> factory)
+{
+    return my->get_shared_api_state(name, factory);
+}
+
 void application::get_max_block_age(int32_t& result)
 {
     my->get_max_block_age(result);
 }
 
+api_metrics& application::get_api_metrics()
+{
+    return my->_api_metrics;
+}
+
 fc::api<network_broadcast_api>& application::get_write_node_net_api()
 {
     if (_remote_net_api)
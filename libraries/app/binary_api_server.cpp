@@ -0,0 +1,182 @@
+#include <scorum/app/binary_api_server.hpp>
+#include <scorum/app/api_context.hpp>
+#include <scorum/app/application.hpp>
+#include <scorum/app/rpc_executor.hpp>
+
+#include <fc/exception/exception.hpp>
+#include <fc/thread/thread.hpp>
+
+namespace scorum {
+namespace app {
+
+namespace {
+
+const uint32_t max_request_size = 1024 * 1024;
+}
+
+binary_api_server::binary_api_server(application& app, const std::vector<std::string>& apis, rpc_executor* executor)
+    : _app(app)
+    , _apis(apis)
+    , _executor(executor)
+{
+}
+
+binary_api_server::~binary_api_server()
+{
+    try
+    {
+        _server.close();
+
+        if (_accept_loop.valid())
+            _accept_loop.cancel_and_wait("binary_api_server closed");
+
+        // serve() erases finished connections, so the map is moved out before waiting for them
+        std::map<std::shared_ptr<fc::tcp_socket>, fc::future<void>> connections;
+        connections.swap(_connections);
+
+        for (auto& connection : connections)
+        {
+            connection.first->close();
+            connection.second.cancel_and_wait("binary_api_server closed");
+        }
+    }
+    FC_CAPTURE_AND_LOG(())
+}
+
+void binary_api_server::listen(const fc::ip::endpoint& endpoint)
+{
+    _server.set_reuse_address();
+    _server.listen(endpoint);
+
+    _accept_loop = fc::async([this]() { accept_loop(); }, "binary_api_server accept loop");
+}
+
+void binary_api_server::accept_loop()
+{
+    while (!_accept_loop.canceled())
+    {
+        auto socket = std::make_shared<fc::tcp_socket>();
+
+        try
+        {
+            _server.accept(*socket);
+        }
+        catch (const fc::canceled_exception&)
+        {
+            throw;
+        }
+        FC_CAPTURE_AND_LOG(())
+
+        if (!socket->is_open())
+            continue;
+
+        _connections[socket] = fc::async([this, socket]() { serve(socket); }, "binary_api_server connection");
+    }
+}
+
+void binary_api_server::serve(std::shared_ptr<fc::tcp_socket> socket)
+{
+    try
+    {
+        // the session owns API instances of the connection
+        std::shared_ptr<api_session_data> session = std::make_shared<api_session_data>();
+
+        // shared with the workers which may still execute a call when the connection is closed
+        const auto apis = std::make_shared<apis_type>(create_apis(session));
+
+        while (true)
+        {
+            uint32_t size = 0;
+            socket->read((char*)&size, sizeof(size));
+
+            FC_ASSERT(size <= max_request_size, "Request is too large (${size} bytes).", ("size", size));
+
+            std::vector<char> frame(size);
+            if (size)
+                socket->read(frame.data(), size);
+
+            const auto request = fc::raw::unpack<binary_api_request>(frame);
+
+            api_metrics& metrics = _app.get_api_metrics();
+            const fc::time_point start = fc::time_point::now();
+
+            std::vector<char> response;
+            if (_executor && _executor->is_pooled(request.api))
+            {
+                response = _executor->run<std::vector<char>>(request.api, [&metrics, session, apis, request]() {
+                    return metrics.measure_read_lock_wait<std::vector<char>>(
+                        request.api, request.method, [&]() { return fc::raw::pack(call(*apis, request)); });
+                });
+            }
+            else
+            {
+                response = metrics.measure_read_lock_wait<std::vector<char>>(
+                    request.api, request.method, [&]() { return fc::raw::pack(call(*apis, request)); });
+            }
+
+            metrics.record_call(request.api, request.method, fc::time_point::now() - start, response.size());
+
+            size = response.size();
+            socket->write((const char*)&size, sizeof(size));
+            socket->write(response.data(), response.size());
+            socket->flush();
+        }
+    }
+    catch (const fc::eof_exception&)
+    {
+    }
+    catch (const fc::canceled_exception&)
+    {
+    }
+    FC_CAPTURE_AND_LOG(())
+
+    socket->close();
+    _connections.erase(socket);
+}
+
+binary_api_server::apis_type binary_api_server::create_apis(const std::shared_ptr<api_session_data>& session)
+{
+    apis_type apis;
+
+    for (const std::string& name : _apis)
+    {
+        api_context ctx(_app, name, session);
+
+        binary_api_methods methods = _app.create_binary_api_by_name(ctx);
+        if (!methods.empty())
+            apis.emplace(name, std::move(methods));
+    }
+
+    return apis;
+}
+
+binary_api_response binary_api_server::call(const apis_type& apis, const binary_api_request& request)
+{
+    binary_api_response response;
+    response.id = request.id;
+
+    try
+    {
+        auto api_itr = apis.find(request.api);
+        FC_ASSERT(api_itr != apis.end(), "API ${api} is not available in binary RPC.", ("api", request.api));
+
+        auto method_itr = api_itr->second.find(request.method);
+        FC_ASSERT(method_itr != api_itr->second.end(), "Method ${api}.${method} is not available in binary RPC.",
+                  ("api", request.api)("method", request.method));
+
+        fc::datastream<const char*> params(request.params.data(), request.params.size());
+        response.result = method_itr->second(params);
+    }
+    catch (const fc::exception& e)
+    {
+        response.error = e.to_string();
+    }
+    catch (const std::exception& e)
+    {
+        response.error = std::string(e.what());
+    }
+
+    return response;
+}
+}
+}
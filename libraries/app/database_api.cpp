@@ -1,6 +1,7 @@
 #include <scorum/app/api_context.hpp>
 #include <scorum/app/application.hpp>
 #include <scorum/app/database_api.hpp>
+#include <scorum/app/versioned_cache.hpp>
 
 #include <scorum/protocol/get_config.hpp>
 
@@ -17,6 +18,7 @@
 #include <scorum/chain/services/registration_committee.hpp>
 #include <scorum/chain/services/reward_funds.hpp>
 #include <scorum/chain/services/withdraw_scorumpower_route.hpp>
+#include <scorum/chain/services/witness.hpp>
 #include <scorum/chain/services/witness_schedule.hpp>
 #include <scorum/chain/services/registration_pool.hpp>
 #include <scorum/chain/services/reward_balancer.hpp>
@@ -49,6 +51,17 @@ namespace app {
 
 class database_api_impl;
 
+/**
+ * Front-ends request the same accounts and global properties many times between blocks,
+ * so built API objects are reused by all connections until the chain state is changed.
+ */
+struct database_api_cache
+{
+    versioned_value<dynamic_global_property_api_obj> dynamic_global_properties;
+    versioned_value<witness_schedule_api_obj> witness_schedule;
+    versioned_cache<std::string, fc::optional<extended_account>> accounts;
+};
+
 class database_api_impl : public std::enable_shared_from_this<database_api_impl>
 {
 public:
@@ -68,6 +81,7 @@ public:
 
     // Accounts
     std::vector<extended_account> get_accounts(const std::vector<std::string>& names) const;
+    fc::optional<extended_account> get_account(const std::string& name) const;
     std::vector<account_id_type> get_account_references(account_id_type account_id) const;
     std::vector<optional<account_api_obj>> lookup_account_names(const std::vector<std::string>& account_names) const;
     std::set<std::string> lookup_accounts(const std::string& lower_bound_name, uint32_t limit) const;
@@ -112,6 +126,8 @@ public:
 
     scorum::chain::database& _db;
 
+    std::shared_ptr<database_api_cache> _cache;
+
     boost::signals2::scoped_connection _block_applied_connection;
 
     registration_committee_api_obj get_registration_committee() const;
@@ -165,6 +181,7 @@ database_api::~database_api()
 
 database_api_impl::database_api_impl(const scorum::app::api_context& ctx)
     : _db(*ctx.app.chain_database())
+    , _cache(ctx.app.get_shared_api_state<database_api_cache>("database_api"))
 {
     wlog("creating database api ${x}", ("x", int64_t(this)));
 }
@@ -201,26 +218,28 @@ dynamic_global_property_api_obj database_api::get_dynamic_global_properties() co
 
 dynamic_global_property_api_obj database_api_impl::get_dynamic_global_properties() const
 {
-    dynamic_global_property_api_obj gpao;
-    gpao = _db.obtain_service<dbs_dynamic_global_property>().get();
-
-    if (_db.has_index<witness::reserve_ratio_index>())
-    {
-        const auto& r = _db.find(witness::reserve_ratio_id_type());
+    return _cache->dynamic_global_properties.get(_db.write_generation(), [&]() {
+        dynamic_global_property_api_obj gpao;
+        gpao = _db.obtain_service<dbs_dynamic_global_property>().get();
 
-        if (BOOST_LIKELY(r != nullptr))
+        if (_db.has_index<witness::reserve_ratio_index>())
         {
-            gpao = *r;
+            const auto& r = _db.find(witness::reserve_ratio_id_type());
+
+            if (BOOST_LIKELY(r != nullptr))
+            {
+                gpao = *r;
+            }
         }
-    }
 
-    gpao.registration_pool_balance = _db.obtain_service<dbs_registration_pool>().get().balance;
-    gpao.fund_budget_balance = _db.obtain_service<dbs_budget>().get_fund_budget().balance;
-    gpao.reward_pool_balance = _db.obtain_service<dbs_reward>().get().balance;
-    gpao.content_reward_scr_balance = _db.obtain_service<dbs_reward_fund_scr>().get().activity_reward_balance;
-    gpao.content_reward_sp_balance = _db.obtain_service<dbs_reward_fund_sp>().get().activity_reward_balance;
+        gpao.registration_pool_balance = _db.obtain_service<dbs_registration_pool>().get().balance;
+        gpao.fund_budget_balance = _db.obtain_service<dbs_budget>().get_fund_budget().balance;
+        gpao.reward_pool_balance = _db.obtain_service<dbs_reward>().get().balance;
+        gpao.content_reward_scr_balance = _db.obtain_service<dbs_reward_fund_scr>().get().activity_reward_balance;
+        gpao.content_reward_sp_balance = _db.obtain_service<dbs_reward_fund_sp>().get().activity_reward_balance;
 
-    return gpao;
+        return gpao;
+    });
 }
 
 chain_id_type database_api::get_chain_id() const
@@ -235,7 +254,11 @@ chain_id_type database_api_impl::get_chain_id() const
 
 witness_schedule_api_obj database_api::get_witness_schedule() const
 {
-    return my->_db.with_read_lock([&]() { return my->_db.get(witness_schedule_id_type()); });
+    return my->_db.with_read_lock([&]() {
+        return my->_cache->witness_schedule.get(my->_db.write_generation(), [&]() -> witness_schedule_api_obj {
+            return my->_db.get(witness_schedule_id_type());
+        });
+    });
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -272,28 +295,43 @@ std::vector<extended_account> database_api::get_accounts(const std::vector<std::
 }
 
 std::vector<extended_account> database_api_impl::get_accounts(const std::vector<std::string>& names) const
+{
+    const uint64_t version = _db.write_generation();
+
+    std::vector<extended_account> results;
+    results.reserve(names.size());
+
+    for (const auto& name : names)
+    {
+        auto account = _cache->accounts.get(name, version, [&]() { return get_account(name); });
+        if (account.valid())
+            results.push_back(std::move(*account));
+    }
+
+    return results;
+}
+
+fc::optional<extended_account> database_api_impl::get_account(const std::string& name) const
 {
     const auto& idx = _db.get_index<account_index>().indices().get<by_name>();
     const auto& vidx = _db.get_index<witness_vote_index>().indices().get<by_account_witness>();
-    std::vector<extended_account> results;
 
-    for (auto name : names)
+    fc::optional<extended_account> result;
+
+    auto itr = idx.find(name);
+    if (itr != idx.end())
     {
-        auto itr = idx.find(name);
-        if (itr != idx.end())
-        {
-            results.push_back(extended_account(*itr, _db));
+        result = extended_account(*itr, _db);
 
-            auto vitr = vidx.lower_bound(boost::make_tuple(itr->id, witness_id_type()));
-            while (vitr != vidx.end() && vitr->account == itr->id)
-            {
-                results.back().witness_votes.insert(_db.get(vitr->witness).owner);
-                ++vitr;
-            }
+        auto vitr = vidx.lower_bound(boost::make_tuple(itr->id, witness_id_type()));
+        while (vitr != vidx.end() && vitr->account == itr->id)
+        {
+            result->witness_votes.insert(_db.get(vitr->witness).owner);
+            ++vitr;
         }
     }
 
-    return results;
+    return result;
 }
 
 std::vector<account_id_type> database_api::get_account_references(account_id_type account_id) const
@@ -571,21 +609,14 @@ std::set<account_name_type> database_api_impl::lookup_witness_accounts(const std
                                                                        uint32_t limit) const
 {
     FC_ASSERT(limit <= LOOKUP_LIMIT);
-    const auto& witnesses_by_id = _db.get_index<witness_index>().indices().get<by_id>();
-
-    // get all the names and look them all up, sort them, then figure out what
-    // records to return.  This could be optimized, but we expect the
-    // number of witnesses to be few and the frequency of calls to be rare
-    std::set<account_name_type> witnesses_by_account_name;
-    for (const witness_api_obj& witness : witnesses_by_id)
-        if (witness.owner >= lower_bound_name) // we can ignore anything below lower_bound_name
-            witnesses_by_account_name.insert(witness.owner);
-
-    auto end_iter = witnesses_by_account_name.begin();
-    while (end_iter != witnesses_by_account_name.end() && limit--)
-        ++end_iter;
-    witnesses_by_account_name.erase(end_iter, witnesses_by_account_name.end());
-    return witnesses_by_account_name;
+
+    std::set<account_name_type> result;
+
+    for (const witness_object& witness :
+         _db.obtain_service<chain::dbs_witness>().get_witnesses_by_name(lower_bound_name, limit))
+        result.insert(witness.owner);
+
+    return result;
 }
 
 uint64_t database_api::get_witness_count() const
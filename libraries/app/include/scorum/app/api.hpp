@@ -24,6 +24,7 @@
 #pragma once
 
 #include <scorum/app/api_context.hpp>
+#include <scorum/app/api_metrics.hpp>
 #include <scorum/app/database_api.hpp>
 #include <scorum/protocol/types.hpp>
 
@@ -176,6 +177,53 @@ private:
     application& _app;
 };
 
+/**
+ * @brief Time the node threads waited for the chain database locks since the node start
+ */
+struct database_lock_stats
+{
+    uint64_t read_locks = 0;
+    uint64_t read_lock_wait_us = 0;
+    uint64_t write_locks = 0;
+    uint64_t write_lock_wait_us = 0;
+};
+
+/**
+ * @brief The node_metrics_api class provides statistics of API calls, of the chain database locking and of the P2P node
+ */
+class node_metrics_api
+{
+public:
+    node_metrics_api(const api_context& a);
+
+    /**
+     * @brief Get number of calls, latency histogram, response size and read lock wait of every called API method
+     */
+    std::vector<api_method_stats> get_api_stats() const;
+
+    /**
+     * @brief Get time the API calls and block processing waited for the chain database locks
+     */
+    database_lock_stats get_database_lock_stats() const;
+
+    /**
+     * @brief Get bandwidth, send queue and request latency of the connected peers, sync state and timing of the
+     * calls from the P2P layer to the chain
+     */
+    graphene::net::node_statistics get_p2p_statistics() const;
+
+    /**
+     * @brief Get all the statistics in Prometheus text exposition format
+     */
+    std::string get_prometheus_metrics() const;
+
+    /// internal method, not exposed via JSON RPC
+    void on_api_startup();
+
+private:
+    application& _app;
+};
+
 struct scorum_version_info
 {
     scorum_version_info()
@@ -230,6 +278,7 @@ private:
 
 FC_REFLECT(scorum::app::network_broadcast_api::transaction_confirmation, (id)(block_num)(trx_num)(expired))
 FC_REFLECT(scorum::app::scorum_version_info, (blockchain_version)(scorum_revision)(fc_revision))
+FC_REFLECT(scorum::app::database_lock_stats, (read_locks)(read_lock_wait_us)(write_locks)(write_lock_wait_us))
 // FC_REFLECT_TYPENAME( fc::ecc::compact_signature );
 // FC_REFLECT_TYPENAME( fc::ecc::commitment_type );
 
@@ -239,4 +288,6 @@ FC_API(scorum::app::network_broadcast_api,
 FC_API(scorum::app::network_node_api,
        (get_info)(add_node)(get_connected_peers)(get_potential_peers)(get_advanced_node_parameters)(
            set_advanced_node_parameters))
+FC_API(scorum::app::node_metrics_api,
+       (get_api_stats)(get_database_lock_stats)(get_p2p_statistics)(get_prometheus_metrics))
 FC_API(scorum::app::login_api, (login)(get_api_by_name)(get_version))
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <chainbase/database_guard.hpp>
+
+#include <fc/reflect/reflect.hpp>
+#include <fc/time.hpp>
+
+#include <array>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace scorum {
+namespace app {
+
+/**
+ * Statistics of API method calls since the node start.
+ */
+struct api_method_stats
+{
+    std::string api;
+    std::string method;
+
+    uint64_t calls = 0;
+    uint64_t total_latency_us = 0;
+    uint64_t max_latency_us = 0;
+
+    /// number of calls with latency up to the bound of api_metrics::latency_buckets_us, the last one is unbounded
+    std::vector<uint64_t> latency_buckets;
+
+    uint64_t response_bytes = 0;
+
+    /// time spent waiting for the chain database read lock
+    uint64_t read_lock_wait_us = 0;
+};
+
+/**
+ * Collects latency, response size and read lock wait of API calls made through websocket, HTTP and binary RPC.
+ * Calls are recorded by the RPC layer, API implementations are not changed.
+ */
+class api_metrics
+{
+public:
+    static const std::array<uint64_t, 10> latency_buckets_us;
+
+    void record_call(const std::string& api, const std::string& method, const fc::microseconds& latency,
+                     uint64_t response_size);
+
+    void record_read_lock_wait(const std::string& api, const std::string& method, uint64_t wait_us);
+
+    /// executes the call and records the time it waited for the read lock, on the thread executing the call
+    template <typename T>
+    T measure_read_lock_wait(const std::string& api, const std::string& method, const std::function<T()>& call)
+    {
+        const uint64_t wait_before = chainbase::database_guard::thread_read_lock_wait_microseconds();
+
+        T result = call();
+
+        record_read_lock_wait(api, method,
+                              chainbase::database_guard::thread_read_lock_wait_microseconds() - wait_before);
+
+        return result;
+    }
+
+    std::vector<api_method_stats> get_stats() const;
+
+private:
+    api_method_stats& get(const std::string& api, const std::string& method);
+
+    mutable std::mutex _mutex;
+    std::map<std::pair<std::string, std::string>, api_method_stats> _stats;
+};
+
+/**
+ * Prints the statistics in Prometheus text exposition format.
+ */
+std::string to_prometheus_text(const std::vector<api_method_stats>& stats);
+}
+}
+
+FC_REFLECT(scorum::app::api_method_stats,
+           (api)(method)(calls)(total_latency_us)(max_latency_us)(latency_buckets)(response_bytes)(read_lock_wait_us))
@@ -25,6 +25,8 @@
 
 #include <scorum/app/api_access.hpp>
 #include <scorum/app/api_context.hpp>
+#include <scorum/app/api_metrics.hpp>
+#include <scorum/app/binary_api.hpp>
 #include <scorum/chain/database/database.hpp>
 
 #include <graphene/net/node.hpp>
@@ -133,6 +135,34 @@ public:
      */
     fc::api_ptr create_api_by_name(const api_context& ctx);
 
+    /**
+     * Register the methods of the named API which are served by the binary RPC (see binary_api.hpp). The factory
+     * gets the API instance created by the factory registered with register_api_factory.
+     */
+    void register_binary_api(const std::string& name, std::function<binary_api_methods(const fc::api_ptr&)> factory);
+
+    /**
+     * Instantiate the named API for the binary RPC. The instance is kept in the session of the context, the result
+     * is empty if the API has no binary methods.
+     */
+    binary_api_methods create_binary_api_by_name(const api_context& ctx);
+
+    /**
+     * Returns the object shared by API instances of all connections (caches, etc.), it is created on the first call.
+     */
+    template <typename T> std::shared_ptr<T> get_shared_api_state(const std::string& name)
+    {
+        return std::static_pointer_cast<T>(
+            get_shared_api_state(name, []() -> std::shared_ptr<void> { return std::make_shared<T>(); }));
+    }
+
+    std::shared_ptr<void> get_shared_api_state(const std::string& name, std::function<std::shared_ptr<void>()> factory);
+
+    /**
+     * Statistics of API calls made through RPC (see node_metrics_api).
+     */
+    api_metrics& get_api_metrics();
+
     void get_max_block_age(int32_t& result);
 
     fc::api<network_broadcast_api>& get_write_node_net_api();
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <fc/api.hpp>
+#include <fc/io/datastream.hpp>
+#include <fc/io/raw.hpp>
+#include <fc/optional.hpp>
+#include <fc/reflect/reflect.hpp>
+
+#include <functional>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace scorum {
+namespace app {
+
+/**
+ * Binary RPC (see "rpc-binary-endpoint" option) is an alternative to the websocket JSON RPC for clients that read
+ * large amounts of data (indexers, etc.). Requests and responses are fc::raw packed and sent over plain TCP as
+ * frames prefixed with the 32 bit little endian size of the frame:
+ *
+ *     [uint32 size][binary_api_request]  ->  [uint32 size][binary_api_response]
+ *
+ * Params of the request are the packed arguments of the method one after another, result of the response is the
+ * packed return value. The same API instances as for the websocket connections are used, but result objects are
+ * packed directly without fc::variant conversion and JSON printing.
+ *
+ * Only public APIs are available (there is no login) and only the methods explicitly registered with
+ * application::register_binary_api.
+ */
+struct binary_api_request
+{
+    uint64_t id = 0;
+    std::string api;
+    std::string method;
+    std::vector<char> params;
+};
+
+struct binary_api_response
+{
+    uint64_t id = 0;
+    std::vector<char> result;
+    fc::optional<std::string> error;
+};
+
+using binary_method = std::function<std::vector<char>(fc::datastream<const char*>& params)>;
+using binary_api_methods = std::map<std::string, binary_method>;
+
+namespace detail {
+
+template <typename R> R call_with_unpacked_params(const std::function<R()>& method, fc::datastream<const char*>&)
+{
+    return method();
+}
+
+template <typename R, typename Arg, typename... Args>
+R call_with_unpacked_params(const std::function<R(Arg, Args...)>& method, fc::datastream<const char*>& params)
+{
+    typename std::decay<Arg>::type arg;
+    fc::raw::unpack(params, arg);
+
+    std::function<R(Args...)> rest = [&](Args... args) { return method(arg, std::forward<Args>(args)...); };
+
+    return call_with_unpacked_params(rest, params);
+}
+}
+
+/**
+ * Makes binary method from the method of fc::api, e.g. make_binary_method(api->get_blocks_history)
+ */
+template <typename R, typename... Args> binary_method make_binary_method(const std::function<R(Args...)>& method)
+{
+    static_assert(!std::is_void<R>::value, "Binary methods must return a value.");
+
+    return [method](fc::datastream<const char*>& params) -> std::vector<char> {
+        return fc::raw::pack(detail::call_with_unpacked_params(method, params));
+    };
+}
+}
+}
+
+FC_REFLECT(scorum::app::binary_api_request, (id)(api)(method)(params))
+FC_REFLECT(scorum::app::binary_api_response, (id)(result)(error))
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <scorum/app/binary_api.hpp>
+
+#include <fc/network/ip.hpp>
+#include <fc/network/tcp_socket.hpp>
+#include <fc/thread/future.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace scorum {
+namespace app {
+
+class application;
+class rpc_executor;
+struct api_session_data;
+
+/**
+ * Serves binary RPC (see binary_api.hpp) on a dedicated TCP endpoint. Each connection gets its own instances of
+ * the public APIs like a websocket connection does, requests of a connection are processed one by one.
+ *
+ * Calls of the APIs pooled by the executor (if any) are executed by its worker threads.
+ */
+class binary_api_server
+{
+public:
+    using apis_type = std::map<std::string, binary_api_methods>;
+
+    binary_api_server(application& app, const std::vector<std::string>& apis, rpc_executor* executor = nullptr);
+    ~binary_api_server();
+
+    void listen(const fc::ip::endpoint& endpoint);
+
+private:
+    void accept_loop();
+    void serve(std::shared_ptr<fc::tcp_socket> socket);
+
+    apis_type create_apis(const std::shared_ptr<api_session_data>& session);
+
+    static binary_api_response call(const apis_type& apis, const binary_api_request& request);
+
+    application& _app;
+    const std::vector<std::string> _apis;
+    rpc_executor* _executor;
+
+    fc::tcp_server _server;
+    fc::future<void> _accept_loop;
+
+    std::map<std::shared_ptr<fc::tcp_socket>, fc::future<void>> _connections;
+};
+}
+}
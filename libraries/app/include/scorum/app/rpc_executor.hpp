@@ -0,0 +1,90 @@
+#pragma once
+
+#include <fc/exception/exception.hpp>
+#include <fc/thread/future.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace scorum {
+namespace app {
+
+/**
+ * Executes API calls on a pool of worker threads (see "rpc-worker-threads" option) instead of the thread of the
+ * RPC server, so calls of different connections are parsed, executed and serialized on multiple cores.
+ *
+ * Only APIs passed to the constructor are executed by the pool, each of them with its own limit of calls executed
+ * at the same time. Calls over the limit are queued and do not occupy worker threads, so a burst of heavy calls
+ * of one API can not take all the workers.
+ */
+class rpc_executor
+{
+public:
+    /// api_limits maps API name to the maximum number of its calls executed at the same time, 0 for no limit
+    rpc_executor(uint32_t threads, const std::map<std::string, uint32_t>& api_limits);
+    ~rpc_executor();
+
+    bool is_pooled(const std::string& api) const;
+
+    /**
+     * Runs the task on a worker thread. The calling fc thread is not blocked while the task is executed,
+     * it serves other tasks (connections) in the meantime.
+     */
+    template <typename T> T run(const std::string& api, std::function<T()> task)
+    {
+        typename fc::promise<T>::ptr prom(new fc::promise<T>("rpc_executor::run"));
+
+        // the task is owned by the worker, the caller may be canceled while it is executed
+        post(api, [prom, task]() {
+            try
+            {
+                prom->set_value(task());
+            }
+            catch (const fc::exception& e)
+            {
+                prom->set_exception(e.dynamic_copy_exception());
+            }
+            catch (const std::exception& e)
+            {
+                prom->set_exception(
+                    std::make_shared<fc::exception>(FC_LOG_MESSAGE(error, "${what}", ("what", e.what()))));
+            }
+        });
+
+        return fc::future<T>(prom).wait();
+    }
+
+private:
+    struct api_queue
+    {
+        uint32_t limit = 0;
+        uint32_t running = 0;
+        std::deque<std::function<void()>> pending;
+    };
+
+    struct ready_task
+    {
+        api_queue* queue;
+        std::function<void()> task;
+    };
+
+    void post(const std::string& api, std::function<void()> task);
+    void worker_loop();
+
+    std::map<std::string, api_queue> _queues;
+
+    std::mutex _mutex;
+    std::condition_variable _ready_cv;
+    std::deque<ready_task> _ready;
+    bool _stopped = false;
+
+    std::vector<std::thread> _workers;
+};
+}
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <functional>
+#include <limits>
+#include <map>
+#include <mutex>
+
+namespace scorum {
+namespace app {
+
+/**
+ * Keeps API objects built from the chain state together with the version of the state they were built from.
+ * The version is chainbase::database_guard::write_generation() taken under the read lock, so all entries are
+ * dropped at once as soon as any request observes the newer state.
+ *
+ * The write lock is also taken for every pending transaction, so on a busy node entries live only between two
+ * incoming transactions rather than for the whole block. This is deliberate: API results include the pending
+ * state (balances, global properties), and a key of the head block alone would return outdated results.
+ *
+ * Shared by API instances of all connections (see application::get_shared_api_state).
+ *
+ * The number of entries is limited by max_size. Values of a varying size (lists of posts with bodies, etc.) are
+ * also limited by the total of max_bytes estimated by size_of, entries above the limits are built but not kept.
+ */
+template <typename Key, typename Value> class versioned_cache
+{
+public:
+    using size_of_type = std::function<size_t(const Key&, const Value&)>;
+
+    explicit versioned_cache(size_t max_size = 10000)
+        : _max_size(max_size)
+        , _max_bytes(std::numeric_limits<size_t>::max())
+    {
+    }
+
+    versioned_cache(size_t max_size, size_t max_bytes, size_of_type size_of)
+        : _max_size(max_size)
+        , _max_bytes(max_bytes)
+        , _size_of(std::move(size_of))
+    {
+    }
+
+    template <typename Builder> Value get(const Key& key, uint64_t version, Builder&& build)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            reset_if_outdated(version);
+
+            auto it = _entries.find(key);
+            if (it != _entries.end())
+                return it->second;
+        }
+
+        // building is done without lock, concurrent readers of the same state may build the same entry twice
+        Value value = build();
+        const size_t bytes = _size_of ? _size_of(key, value) : 0;
+
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if (version == _version && _entries.size() < _max_size && bytes <= _max_bytes - _bytes)
+        {
+            if (_entries.emplace(key, value).second)
+                _bytes += bytes;
+        }
+
+        return value;
+    }
+
+private:
+    void reset_if_outdated(uint64_t version)
+    {
+        // the version is changed only under the write lock, so readers can not observe the older version later
+        if (version != _version)
+        {
+            _entries.clear();
+            _bytes = 0;
+            _version = version;
+        }
+    }
+
+    const size_t _max_size;
+    const size_t _max_bytes;
+    const size_of_type _size_of;
+
+    std::mutex _mutex;
+    uint64_t _version = 0;
+    size_t _bytes = 0;
+    std::map<Key, Value> _entries;
+};
+
+/**
+ * The same as versioned_cache for objects which exist in a single instance (global properties, schedule, etc.)
+ */
+template <typename Value> class versioned_value
+{
+public:
+    template <typename Builder> Value get(uint64_t version, Builder&& build)
+    {
+        return _cache.get(true, version, std::forward<Builder>(build));
+    }
+
+private:
+    versioned_cache<bool, Value> _cache{ 1 };
+};
+
+} // namespace app
+} // namespace scorum
@@ -0,0 +1,104 @@
+#include <scorum/app/rpc_executor.hpp>
+
+#include <fc/log/logger.hpp>
+
+#include <algorithm>
+
+namespace scorum {
+namespace app {
+
+rpc_executor::rpc_executor(uint32_t threads, const std::map<std::string, uint32_t>& api_limits)
+{
+    FC_ASSERT(threads > 0, "rpc_executor requires at least one thread");
+
+    for (const auto& api_limit : api_limits)
+    {
+        api_queue& queue = _queues[api_limit.first];
+        queue.limit = api_limit.second ? std::min(api_limit.second, threads) : threads;
+    }
+
+    _workers.reserve(threads);
+    for (uint32_t i = 0; i < threads; ++i)
+        _workers.emplace_back([this]() { worker_loop(); });
+}
+
+rpc_executor::~rpc_executor()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopped = true;
+    }
+    _ready_cv.notify_all();
+
+    // workers complete all posted tasks before exit, nobody waits forever for a result
+    for (std::thread& worker : _workers)
+        worker.join();
+}
+
+bool rpc_executor::is_pooled(const std::string& api) const
+{
+    return _queues.find(api) != _queues.end();
+}
+
+void rpc_executor::post(const std::string& api, std::function<void()> task)
+{
+    auto itr = _queues.find(api);
+    FC_ASSERT(itr != _queues.end(), "API ${api} is not executed by RPC workers", ("api", api));
+
+    api_queue& queue = itr->second;
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if (queue.running >= queue.limit)
+        {
+            queue.pending.push_back(std::move(task));
+            return;
+        }
+
+        ++queue.running;
+        _ready.push_back(ready_task{ &queue, std::move(task) });
+    }
+    _ready_cv.notify_one();
+}
+
+void rpc_executor::worker_loop()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    while (true)
+    {
+        _ready_cv.wait(lock, [this]() { return _stopped || !_ready.empty(); });
+
+        if (_ready.empty())
+            break;
+
+        ready_task ready = std::move(_ready.front());
+        _ready.pop_front();
+
+        lock.unlock();
+
+        try
+        {
+            ready.task();
+        }
+        FC_CAPTURE_AND_LOG(())
+
+        lock.lock();
+
+        api_queue& queue = *ready.queue;
+        if (!queue.pending.empty())
+        {
+            // the finished call frees the slot of its API for the next queued one
+            _ready.push_back(ready_task{ &queue, std::move(queue.pending.front()) });
+            queue.pending.pop_front();
+            _ready_cv.notify_one();
+        }
+        else
+        {
+            --queue.running;
+        }
+    }
+}
+}
+}
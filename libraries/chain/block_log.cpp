@@ -2,6 +2,16 @@
 #include <fstream>
 #include <fc/io/raw.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #define LOG_READ (std::ios::in | std::ios::binary)
 #define LOG_WRITE (std::ios::out | std::ios::binary | std::ios::app)
 
@@ -9,6 +19,163 @@ namespace scorum {
 namespace chain {
 
 namespace detail {
+
+// number of the recently read blocks kept in memory
+const size_t block_cache_capacity = 1024;
+
+/**
+ * LRU cache of the blocks read from the log. It is split into shards by block number, so readers of different
+ * blocks rarely wait for each other. Blocks of the log never change, so cached blocks are never invalidated.
+ */
+class block_cache
+{
+public:
+    using block_ptr = std::shared_ptr<const signed_block>;
+
+    explicit block_cache(size_t capacity)
+        : _shard_capacity(std::max<size_t>(capacity / shards_count, 1))
+    {
+    }
+
+    block_ptr find(uint32_t block_num)
+    {
+        shard& s = get_shard(block_num);
+        std::lock_guard<std::mutex> lock(s.mutex);
+
+        auto itr = s.blocks.find(block_num);
+        if (itr == s.blocks.end())
+            return block_ptr();
+
+        s.lru.splice(s.lru.begin(), s.lru, itr->second.second);
+
+        return itr->second.first;
+    }
+
+    void insert(uint32_t block_num, const block_ptr& block)
+    {
+        shard& s = get_shard(block_num);
+        std::lock_guard<std::mutex> lock(s.mutex);
+
+        if (s.blocks.find(block_num) != s.blocks.end())
+            return;
+
+        s.lru.push_front(block_num);
+        s.blocks.emplace(block_num, std::make_pair(block, s.lru.begin()));
+
+        if (s.blocks.size() > _shard_capacity)
+        {
+            s.blocks.erase(s.lru.back());
+            s.lru.pop_back();
+        }
+    }
+
+    void clear()
+    {
+        for (shard& s : _shards)
+        {
+            std::lock_guard<std::mutex> lock(s.mutex);
+            s.blocks.clear();
+            s.lru.clear();
+        }
+    }
+
+private:
+    static const size_t shards_count = 16;
+
+    struct shard
+    {
+        std::mutex mutex;
+        std::list<uint32_t> lru;
+        std::unordered_map<uint32_t, std::pair<block_ptr, std::list<uint32_t>::iterator>> blocks;
+    };
+
+    shard& get_shard(uint32_t block_num)
+    {
+        return _shards[block_num % shards_count];
+    }
+
+    const size_t _shard_capacity;
+    shard _shards[shards_count];
+};
+
+/**
+ * Positional (pread) reads of the log files. Unlike the streams it has no file position to share, so it can be
+ * used from several threads at once.
+ */
+class block_log_reader
+{
+public:
+    ~block_log_reader()
+    {
+        close();
+    }
+
+    void open(const fc::path& block_file, const fc::path& index_file)
+    {
+        close();
+
+        _block_fd = ::open(block_file.generic_string().c_str(), O_RDONLY);
+        FC_ASSERT(_block_fd != -1, "Can't open ${f}.", ("f", block_file));
+
+        _index_fd = ::open(index_file.generic_string().c_str(), O_RDONLY);
+        FC_ASSERT(_index_fd != -1, "Can't open ${f}.", ("f", index_file));
+    }
+
+    void close()
+    {
+        if (_block_fd != -1)
+            ::close(_block_fd);
+        if (_index_fd != -1)
+            ::close(_index_fd);
+
+        _block_fd = -1;
+        _index_fd = -1;
+    }
+
+    bool is_open() const
+    {
+        return _block_fd != -1 && _index_fd != -1;
+    }
+
+    uint64_t read_block_pos(uint32_t block_num) const
+    {
+        uint64_t pos = 0;
+        read(_index_fd, (char*)&pos, sizeof(pos), sizeof(uint64_t) * (block_num - 1));
+        return pos;
+    }
+
+    std::vector<char> read_block_data(uint64_t pos, uint64_t size) const
+    {
+        std::vector<char> data(size);
+        read(_block_fd, data.data(), size, pos);
+        return data;
+    }
+
+    uint64_t block_file_size() const
+    {
+        struct stat st;
+        FC_ASSERT(::fstat(_block_fd, &st) == 0, "Can't get size of the block log.");
+        return st.st_size;
+    }
+
+private:
+    static void read(int fd, char* data, uint64_t size, uint64_t pos)
+    {
+        while (size > 0)
+        {
+            const ssize_t count = ::pread(fd, data, size, pos);
+            FC_ASSERT(count > 0, "Can't read ${size} bytes at ${pos} from the block log.", ("size", size)("pos", pos));
+
+            data += count;
+            pos += count;
+            size -= count;
+        }
+    }
+
+    int _block_fd = -1;
+    int _index_fd = -1;
+};
+
 class block_log_impl
 {
 public:
@@ -20,6 +187,43 @@ public:
     fc::path index_file;
     bool block_write;
     bool index_write;
+    bool read_only = false;
+
+    // the last block flushed to the files, blocks up to it are read by reader
+    std::atomic<uint32_t> readable_head_num{ 0 };
+    block_log_reader reader;
+    block_cache cache{ block_cache_capacity };
+
+    // serializes refresh_head of the read only log, it is called by API readers
+    std::mutex refresh_mutex;
+
+    void update_readable_head()
+    {
+        if (!reader.is_open())
+            reader.open(block_file, index_file);
+
+        readable_head_num = head.valid() ? protocol::block_header::num_from_id(head_id) : 0;
+    }
+
+    std::shared_ptr<signed_block> read_block(uint32_t block_num, uint32_t head_num) const
+    {
+        const uint64_t pos = reader.read_block_pos(block_num);
+
+        // each block is followed by its position, the head block may be followed by the blocks not flushed yet,
+        // the data after the block is ignored by unpack
+        const uint64_t end_pos = block_num < head_num ? reader.read_block_pos(block_num + 1) - sizeof(uint64_t)
+                                                      : reader.block_file_size() - sizeof(uint64_t);
+        FC_ASSERT(end_pos > pos, "Wrong position of block ${n} in block log.", ("n", block_num));
+
+        const std::vector<char> data = reader.read_block_data(pos, end_pos - pos);
+
+        auto block = std::make_shared<signed_block>();
+        fc::raw::unpack(data, *block);
+        FC_ASSERT(block->block_num() == block_num, "Wrong block was read from block log.",
+                  ("returned", block->block_num())("expected", block_num));
+
+        return block;
+    }
 
     inline void check_block_read()
     {
@@ -98,6 +302,10 @@ void block_log::open(const fc::path& file)
     if (my->index_stream.is_open())
         my->index_stream.close();
 
+    my->reader.close();
+    my->cache.clear();
+    my->readable_head_num = 0;
+
     my->block_file = file;
     my->index_file = fc::path(file.generic_string() + ".index");
 
@@ -172,6 +380,72 @@ void block_log::open(const fc::path& file)
         my->index_stream.open(my->index_file.generic_string().c_str(), LOG_WRITE);
         my->index_write = true;
     }
+
+    flush();
+}
+
+void block_log::open_read_only(const fc::path& file)
+{
+    try
+    {
+        if (my->block_stream.is_open())
+            my->block_stream.close();
+        if (my->index_stream.is_open())
+            my->index_stream.close();
+
+        my->reader.close();
+        my->cache.clear();
+        my->readable_head_num = 0;
+
+        my->block_file = file;
+        my->index_file = fc::path(file.generic_string() + ".index");
+
+        FC_ASSERT(fc::exists(my->block_file) && fc::exists(my->index_file), "Block log is not found.",
+                  ("file", my->block_file));
+
+        my->block_stream.open(my->block_file.generic_string().c_str(), LOG_READ);
+        my->index_stream.open(my->index_file.generic_string().c_str(), LOG_READ);
+        my->block_write = false;
+        my->index_write = false;
+        my->read_only = true;
+
+        my->reader.open(my->block_file, my->index_file);
+    }
+    FC_LOG_AND_RETHROW()
+}
+
+void block_log::refresh_head(uint32_t block_num) const
+{
+    try
+    {
+        FC_ASSERT(my->read_only, "Head is refreshed only in read only block log.");
+
+        std::lock_guard<std::mutex> lock(my->refresh_mutex);
+
+        if (block_num <= my->readable_head_num)
+            return;
+
+        // the writer flushes the files before it reports new blocks, the streams are not used by readers, so the
+        // block is read by the reader
+        auto block = my->read_block(block_num, block_num);
+
+        my->head = *block;
+        my->head_id = block->id();
+        my->cache.insert(block_num, block);
+
+        my->readable_head_num = block_num;
+    }
+    FC_LOG_AND_RETHROW()
+}
+
+uint32_t block_log::readable_head_num() const
+{
+    return my->readable_head_num;
+}
+
+bool block_log::is_read_only() const
+{
+    return my->read_only;
 }
 
 void block_log::close()
@@ -213,6 +487,9 @@ void block_log::flush()
 {
     my->block_stream.flush();
     my->index_stream.flush();
+
+    if (my->block_stream.is_open())
+        my->update_readable_head();
 }
 
 std::pair<signed_block, uint64_t> block_log::read_block(uint64_t pos) const
@@ -235,13 +512,23 @@ optional<signed_block> block_log::read_block_by_num(uint32_t block_num) const
     try
     {
         optional<signed_block> b;
-        uint64_t pos = get_block_pos(block_num);
-        if (pos != npos)
+
+        const uint32_t head_num = my->readable_head_num;
+        if (block_num == 0 || block_num > head_num)
+            return b;
+
+        auto cached = my->cache.find(block_num);
+        if (cached)
         {
-            b = read_block(pos).first;
-            FC_ASSERT(b->block_num() == block_num, "Wrong block was read from block log.",
-                      ("returned", b->block_num())("expected", block_num));
+            b = *cached;
+            return b;
         }
+
+        auto block = my->read_block(block_num, head_num);
+
+        my->cache.insert(block_num, block);
+
+        b = *block;
         return b;
     }
     FC_LOG_AND_RETHROW()
@@ -251,14 +538,10 @@ uint64_t block_log::get_block_pos(uint32_t block_num) const
 {
     try
     {
-        my->check_index_read();
-
-        if (!(my->head.valid() && block_num <= protocol::block_header::num_from_id(my->head_id) && block_num > 0))
+        if (block_num == 0 || block_num > my->readable_head_num)
             return npos;
-        my->index_stream.seekg(sizeof(uint64_t) * (block_num - 1));
-        uint64_t pos;
-        my->index_stream.read((char*)&pos, sizeof(pos));
-        return pos;
+
+        return my->reader.read_block_pos(block_num);
     }
     FC_LOG_AND_RETHROW()
 }
@@ -98,8 +98,7 @@ void process_funds::distribute_reward(block_task_context& ctx, const asset& user
 
     ctx.push_virtual_operation(producer_reward_operation(witness.name, witness_reward));
 
-    dgp_service.update(
-        [&](dynamic_global_property_object& p) { p.circulating_capital += asset(users_reward.amount, SCORUM_SYMBOL); });
+    dgp_service.accumulate_supply(asset(users_reward.amount, SCORUM_SYMBOL), asset(0, SP_SYMBOL));
 }
 }
 }
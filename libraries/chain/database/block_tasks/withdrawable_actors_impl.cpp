@@ -77,16 +77,12 @@ class update_global_scr_properties_visitor : public void_return_visitor
 
         void operator()(const account_id_type& to) const
         {
-            _dprops_service.update(
-                [&](dynamic_global_property_object& o) { o.total_scorumpower -= asset(_amount.amount, SP_SYMBOL); });
+            _dprops_service.accumulate_supply(asset(0, SCORUM_SYMBOL), -asset(_amount.amount, SP_SYMBOL));
         }
 
         void operator()(const dev_committee_id_type& to) const
         {
-            _dprops_service.update([&](dynamic_global_property_object& o) {
-                o.total_scorumpower -= asset(_amount.amount, SP_SYMBOL);
-                o.circulating_capital -= _amount;
-            });
+            _dprops_service.accumulate_supply(-_amount, -asset(_amount.amount, SP_SYMBOL));
         }
 
     private:
@@ -106,9 +102,7 @@ class update_global_scr_properties_visitor : public void_return_visitor
 
         void operator()(const account_id_type& to) const
         {
-            _dprops_service.update([&](dynamic_global_property_object& o) {
-                o.circulating_capital += asset(_amount.amount, SCORUM_SYMBOL);
-            });
+            _dprops_service.accumulate_supply(asset(_amount.amount, SCORUM_SYMBOL), asset(0, SP_SYMBOL));
         }
 
         void operator()(const dev_committee_id_type& to) const
@@ -164,10 +158,7 @@ class update_global_sp_properties_visitor : public void_return_visitor
 
         void operator()(const dev_committee_id_type& to) const
         {
-            _dprops_service.update([&](dynamic_global_property_object& o) {
-                o.total_scorumpower -= _amount;
-                o.circulating_capital -= asset(_amount.amount, SCORUM_SYMBOL);
-            });
+            _dprops_service.accumulate_supply(-asset(_amount.amount, SCORUM_SYMBOL), -_amount);
         }
 
     private:
@@ -187,10 +178,7 @@ class update_global_sp_properties_visitor : public void_return_visitor
 
         void operator()(const account_id_type& to) const
         {
-            _dprops_service.update([&](dynamic_global_property_object& o) {
-                o.total_scorumpower += _amount;
-                o.circulating_capital += asset(_amount.amount, SCORUM_SYMBOL);
-            });
+            _dprops_service.accumulate_supply(asset(_amount.amount, SCORUM_SYMBOL), _amount);
         }
 
         void operator()(const dev_committee_id_type& to) const
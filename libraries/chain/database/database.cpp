@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cstdint>
 #include <deque>
 #include <fstream>
@@ -36,6 +37,7 @@
 #include <scorum/chain/schema/dynamic_global_property_object.hpp>
 #include <scorum/chain/schema/registration_objects.hpp>
 #include <scorum/chain/schema/reward_balancer_object.hpp>
+#include <scorum/chain/schema/reward_objects.hpp>
 #include <scorum/chain/schema/scorum_objects.hpp>
 #include <scorum/chain/schema/transaction_object.hpp>
 #include <scorum/chain/schema/withdraw_scorumpower_objects.hpp>
@@ -139,6 +141,8 @@ void database::open(const fc::path& data_dir,
 
             auto log_head = _block_log.head();
 
+            publish_block_num(log_head ? log_head->block_num() : 0);
+
             // Rewind all undo state. This should return us to the state at the last irreversible block.
             with_write_lock([&]() {
                 for_each_index([&](chainbase::abstract_generic_index_i& item) { item.undo_all(); });
@@ -161,6 +165,12 @@ void database::open(const fc::path& data_dir,
                 _fork_db.start_block(*head_block);
             }
         }
+        else if (fc::exists(data_dir / "block_log"))
+        {
+            // blocks are read from the log written by the writer process, reversible blocks are not available
+            _block_log.open_read_only(data_dir / "block_log");
+            _block_log.refresh_head(published_block_num());
+        }
 
         try
         {
@@ -214,6 +224,7 @@ void database::reindex(const fc::path& data_dir,
                               << " of " << last_block_num << "   (" << (get_free_memory() / (1024 * 1024))
                               << "M free)\n";
                 apply_block(itr.first, skip_flags);
+                _grow_shared_memory_if_needed();
                 itr = _block_log.read_block(itr.second);
             }
 
@@ -370,6 +381,8 @@ optional<signed_block> database::fetch_block_by_number(uint32_t block_num) const
     {
         optional<signed_block> b;
 
+        sync_block_log();
+
         auto results = _fork_db.fetch_block_by_number(block_num);
         if (results.size() == 1)
         {
@@ -387,9 +400,57 @@ optional<signed_block> database::fetch_block_by_number(uint32_t block_num) const
 
 optional<signed_block> database::read_block_by_number(uint32_t block_num) const
 {
+    sync_block_log();
+
     return _block_log.read_block_by_num(block_num);
 }
 
+void database::sync_block_log() const
+{
+    if (!_block_log.is_read_only())
+        return;
+
+    const uint32_t published_num = published_block_num();
+    if (_block_log.readable_head_num() < published_num)
+        _block_log.refresh_head(published_num);
+}
+
+std::vector<signed_block> database::fetch_block_range(uint32_t first_block_num, uint32_t count) const
+{
+    try
+    {
+        std::vector<signed_block> result;
+        result.reserve(count);
+
+        sync_block_log();
+
+        const uint32_t last_block_num = first_block_num + count;
+        const uint32_t log_head_num = _block_log.readable_head_num();
+
+        uint32_t block_num = first_block_num;
+
+        // positional reads, API readers don't share the file position of the log streams
+        for (; block_num < last_block_num && block_num <= log_head_num; ++block_num)
+        {
+            auto block = _block_log.read_block_by_num(block_num);
+            if (!block)
+                break;
+            result.push_back(std::move(*block));
+        }
+
+        for (; block_num < last_block_num; ++block_num)
+        {
+            auto block = fetch_block_by_number(block_num);
+            if (!block)
+                break;
+            result.push_back(std::move(*block));
+        }
+
+        return result;
+    }
+    FC_CAPTURE_AND_RETHROW((first_block_num)(count))
+}
+
 const signed_transaction database::get_recent_transaction(const transaction_id_type& trx_id) const
 {
     try
@@ -397,12 +458,26 @@ const signed_transaction database::get_recent_transaction(const transaction_id_t
         auto& index = get_index<transaction_index>().indices().get<by_trx_id>();
         auto itr = index.find(trx_id);
         FC_ASSERT(itr != index.end());
-        signed_transaction trx;
-        fc::raw::unpack(itr->packed_trx, trx);
-        return trx;
-        ;
+
+        if (itr->block_num > head_block_num())
+        {
+            auto pending_itr = std::find_if(_pending_tx.begin(), _pending_tx.end(),
+                                            [&](const signed_transaction& trx) { return trx.id() == trx_id; });
+            FC_ASSERT(pending_itr != _pending_tx.end());
+
+            return *pending_itr;
+        }
+
+        optional<signed_block> block = fetch_block_by_id(find_block_id_for_num(itr->block_num));
+        FC_ASSERT(block.valid(), "Block ${n} is not found", ("n", itr->block_num));
+
+        auto trx_itr = std::find_if(block->transactions.begin(), block->transactions.end(),
+                                    [&](const signed_transaction& trx) { return trx.id() == trx_id; });
+        FC_ASSERT(trx_itr != block->transactions.end());
+
+        return *trx_itr;
     }
-    FC_CAPTURE_AND_RETHROW()
+    FC_CAPTURE_AND_RETHROW((trx_id))
 }
 
 std::vector<block_id_type> database::get_block_ids_on_fork(block_id_type head_of_fork) const
@@ -480,6 +555,10 @@ bool database::push_block(const signed_block& new_block, uint32_t skip)
                     result = _push_block(new_block);
                 }
                 FC_CAPTURE_AND_RETHROW((new_block))
+
+                // the pending session is reset and the block session is pushed, pending transactions are
+                // applied again after the file is grown
+                _grow_shared_memory_if_needed();
             });
         });
     });
@@ -845,6 +924,8 @@ void database::pop_block()
         for_each_index([&](chainbase::abstract_generic_index_i& item) { item.undo(); });
 
         _popped_tx.insert(_popped_tx.begin(), head_block->transactions.begin(), head_block->transactions.end());
+
+        notify_popped_block(*head_block);
     }
     FC_CAPTURE_AND_RETHROW()
 }
@@ -904,6 +985,11 @@ void database::notify_applied_block(const signed_block& block)
     SCORUM_TRY_NOTIFY(applied_block, block)
 }
 
+void database::notify_popped_block(const signed_block& block)
+{
+    SCORUM_TRY_NOTIFY(popped_block, block)
+}
+
 void database::notify_on_pending_transaction(const signed_transaction& tx)
 {
     SCORUM_TRY_NOTIFY(on_pending_transaction, tx)
@@ -1130,6 +1216,7 @@ void database::initialize_indexes()
     add_index<comment_index>();
     add_index<comment_statistic_scr_index>();
     add_index<comment_statistic_sp_index>();
+    add_index<comment_content_index>();
     add_index<comment_vote_index>();
     add_index<decline_voting_rights_request_index>();
     add_index<dynamic_global_property_index>();
@@ -1174,6 +1261,12 @@ void database::set_flush_interval(uint32_t flush_blocks)
     _next_flush_block = 0;
 }
 
+void database::set_shared_file_growth(uint64_t grow_step, uint64_t max_size)
+{
+    _shared_file_grow_step = grow_step;
+    _shared_file_max_size = max_size;
+}
+
 //////////////////// private methods ////////////////////
 
 void database::apply_block(const signed_block& next_block, uint32_t skip)
@@ -1205,7 +1298,10 @@ void database::apply_block(const signed_block& next_block, uint32_t skip)
         {
             try
             {
-                validate_invariants();
+                if (_invariants_audit_blocks != 0 && block_num % _invariants_audit_blocks == 0)
+                    validate_invariants();
+                else
+                    validate_block_invariants();
             }
 #ifdef DEBUG
             FC_CAPTURE_AND_RETHROW((next_block));
@@ -1268,6 +1364,74 @@ void database::show_free_memory(bool force)
     }
 }
 
+void database::_grow_shared_memory_if_needed()
+{
+    if (_shared_file_grow_step == 0 || get_free_memory() >= _shared_file_grow_step / 2)
+        return;
+
+    FC_ASSERT(!_pending_tx_session.valid(), "Shared memory file can't be grown while transactions are pending.");
+
+    uint64_t size_increment = _shared_file_grow_step;
+    if (_shared_file_max_size != 0)
+    {
+        uint64_t size = get_size();
+        if (size >= _shared_file_max_size)
+            return;
+
+        size_increment = std::min(size_increment, _shared_file_max_size - size);
+    }
+
+    ilog("Growing shared memory file by ${n}M at block ${b}",
+         ("n", size_increment / (1024 * 1024))("b", head_block_num()));
+
+    try
+    {
+        chainbase::database::grow(size_increment);
+    }
+    catch (const std::exception& e)
+    {
+        elog("Failed to grow shared memory file: ${e}", ("e", e.what()));
+    }
+
+    show_free_memory(true);
+}
+
+namespace {
+
+// witness votes changed by the block are combined and written once per witness, they are dropped if the block
+// failed to apply
+class witness_votes_batch_guard
+{
+public:
+    explicit witness_votes_batch_guard(witness_service_i& service)
+        : _service(service)
+    {
+        _service.begin_witness_votes_batch();
+    }
+
+    ~witness_votes_batch_guard()
+    {
+        if (!_ended)
+            _service.discard_witness_votes_batch();
+    }
+
+    void flush()
+    {
+        _service.flush_witness_votes();
+    }
+
+    void end()
+    {
+        _service.end_witness_votes_batch();
+        _ended = true;
+    }
+
+private:
+    witness_service_i& _service;
+    bool _ended = false;
+};
+}
+
 void database::_apply_block(const signed_block& next_block)
 {
     try
@@ -1325,6 +1489,9 @@ void database::_apply_block(const signed_block& next_block)
                   "Block produced by witness that is not running current hardfork",
                   ("witness", witness)("next_block.witness", next_block.witness)("hardfork_state", hardfork_state));
 
+        witness_votes_batch_guard witness_votes_batch(obtain_service<dbs_witness>());
+        supply_batch_guard supply_batch(obtain_service<dbs_dynamic_global_property>());
+
         for (const auto& trx : next_block.transactions)
         {
             /* We do not need to push the undo state for each transaction
@@ -1346,6 +1513,9 @@ void database::_apply_block(const signed_block& next_block)
         clear_expired_transactions();
         clear_expired_delegations();
 
+        // the schedule is built from the votes and changes the virtual time
+        witness_votes_batch.flush();
+
         // in dbs_database_witness_schedule.cpp
         update_witness_schedule();
 
@@ -1371,6 +1541,11 @@ void database::_apply_block(const signed_block& next_block)
 
         process_hardforks();
 
+        // supply deltas accumulated by block tasks
+        supply_batch.flush();
+
+        witness_votes_batch.end();
+
         // notify observers that the block has been applied
         notify_applied_block(next_block);
     }
@@ -1505,7 +1680,7 @@ void database::_apply_transaction(const signed_transaction& trx)
             create<transaction_object>([&](transaction_object& transaction) {
                 transaction.trx_id = trx_id;
                 transaction.expiration = trx.expiration;
-                fc::raw::pack(transaction.packed_trx, trx);
+                transaction.block_num = head_block_num() + 1;
             });
         }
 
@@ -1730,6 +1905,8 @@ void database::update_last_irreversible_block()
                 }
 
                 _block_log.flush();
+
+                publish_block_num(log_head_num);
             }
         }
 
@@ -1882,13 +2059,152 @@ void database::apply_hardfork(uint32_t hardfork)
 /**
  * Verifies all supply invariants check out
  */
+namespace {
+
+struct supply_totals
+{
+    asset total_supply = asset(0, SCORUM_SYMBOL);
+    asset total_scorumpower = asset(0, SP_SYMBOL);
+    share_type total_vsf_votes = 0;
+};
+
+// Contributions of the objects to the totals. The same functions are used by the full scan and by the block check,
+// so an object added to the supply has to be added here only.
+
+void accumulate(supply_totals& totals, const account_object& account)
+{
+    totals.total_supply += account.balance;
+    totals.total_scorumpower += account.scorumpower;
+    totals.total_vsf_votes
+        += (account.proxy == SCORUM_PROXY_TO_SELF_ACCOUNT
+                ? account.witness_vote_weight()
+                : (SCORUM_MAX_PROXY_RECURSION_DEPTH > 0
+                       ? account.proxied_vsf_votes[SCORUM_MAX_PROXY_RECURSION_DEPTH - 1]
+                       : account.scorumpower.amount));
+}
+
+void accumulate(supply_totals& totals, const escrow_object& escrow)
+{
+    totals.total_supply += escrow.scorum_balance;
+    totals.total_supply += escrow.pending_fee;
+}
+
+template <uint16_t ObjectType, asset_symbol_type SymbolType>
+void accumulate(supply_totals& totals, const reward_fund_object<ObjectType, SymbolType>& fund)
+{
+    totals.total_supply += asset(fund.activity_reward_balance.amount, SCORUM_SYMBOL);
+}
+
+void accumulate(supply_totals& totals, const dynamic_global_property_object& gpo)
+{
+    totals.total_supply += asset(gpo.total_scorumpower.amount, SCORUM_SYMBOL);
+}
+
+void accumulate(supply_totals& totals, const reward_balancer_object& reward)
+{
+    totals.total_supply += reward.balance;
+}
+
+void accumulate(supply_totals& totals, const budget_object& budget)
+{
+    totals.total_supply += budget.balance;
+}
+
+void accumulate(supply_totals& totals, const registration_pool_object& pool)
+{
+    totals.total_supply += pool.balance;
+}
+
+void accumulate(supply_totals& totals, const dev_committee_object& dev_pool)
+{
+    totals.total_supply += asset(dev_pool.sp_balance.amount, SCORUM_SYMBOL);
+    totals.total_supply += dev_pool.scr_balance;
+}
+
+void accumulate(supply_totals& totals, const atomicswap_contract_object& contract)
+{
+    totals.total_supply += contract.amount;
+}
+
+// the totals declared by the dynamic global properties
+void accumulate_declared(supply_totals& totals, const dynamic_global_property_object& gpo)
+{
+    totals.total_supply += gpo.total_supply;
+    totals.total_scorumpower += gpo.total_scorumpower;
+    totals.total_vsf_votes += gpo.total_scorumpower.amount;
+}
+
+// indexes of the objects which hold a part of the supply
+template <typename Visitor> void for_each_supply_index(Visitor& visitor)
+{
+    visitor.template visit<account_index>();
+    visitor.template visit<escrow_index>();
+    visitor.template visit<reward_fund_scr_index>();
+    visitor.template visit<reward_fund_sp_index>();
+    visitor.template visit<fifa_world_cup_2018_bounty_reward_fund_index>();
+    visitor.template visit<dynamic_global_property_index>();
+    visitor.template visit<reward_pool_index>();
+    visitor.template visit<budget_index>();
+    visitor.template visit<registration_pool_index>();
+    visitor.template visit<dev_committee_index>();
+    visitor.template visit<atomicswap_contract_index>();
+}
+
+struct accumulate_objects_visitor
+{
+    const database& db;
+    supply_totals& totals;
+
+    template <typename Index> void visit()
+    {
+        for (const auto& obj : db.get_index<Index>().indices())
+            accumulate(totals, obj);
+    }
+};
+
+struct check_undo_state_visitor
+{
+    check_undo_state_visitor(const database& db_, int64_t revision_)
+        : db(db_)
+        , revision(revision_)
+    {
+    }
+
+    const database& db;
+    const int64_t revision;
+    bool has_undo_state = true;
+
+    template <typename Index> void visit()
+    {
+        has_undo_state = has_undo_state && db.get_index<Index>().has_undo_state(revision);
+    }
+};
+
+struct accumulate_changes_visitor
+{
+    const database& db;
+    supply_totals& added;
+    supply_totals& removed;
+
+    template <typename Index> void visit()
+    {
+        using object_type = typename Index::value_type;
+
+        db.get_index<Index>().for_each_undo_change([&](const object_type* old_obj, const object_type* new_obj) {
+            if (old_obj)
+                accumulate(removed, *old_obj);
+            if (new_obj)
+                accumulate(added, *new_obj);
+        });
+    }
+};
+}
+
 void database::validate_invariants() const
 {
     try
     {
-        asset total_supply = asset(0, SCORUM_SYMBOL);
-        asset total_scorumpower = asset(0, SP_SYMBOL);
-        share_type total_vsf_votes = share_type(0);
+        supply_totals totals;
 
         const auto& gpo = obtain_service<dbs_dynamic_global_property>().get();
 
@@ -1900,75 +2216,87 @@ void database::validate_invariants() const
                       ("vs", itr->votes)("tvs", gpo.total_scorumpower.amount));
         }
 
-        const auto& account_idx = get_index<account_index>().indices().get<by_name>();
-        for (auto itr = account_idx.begin(); itr != account_idx.end(); ++itr)
-        {
-            total_supply += itr->balance;
-            total_scorumpower += itr->scorumpower;
-            total_vsf_votes += (itr->proxy == SCORUM_PROXY_TO_SELF_ACCOUNT
-                                    ? itr->witness_vote_weight()
-                                    : (SCORUM_MAX_PROXY_RECURSION_DEPTH > 0
-                                           ? itr->proxied_vsf_votes[SCORUM_MAX_PROXY_RECURSION_DEPTH - 1]
-                                           : itr->scorumpower.amount));
-        }
+        accumulate_objects_visitor accumulate_objects{ *this, totals };
+        for_each_supply_index(accumulate_objects);
 
-        const auto& escrow_idx = get_index<escrow_index>().indices().get<by_id>();
-        for (auto itr = escrow_idx.begin(); itr != escrow_idx.end(); ++itr)
-        {
-            total_supply += itr->scorum_balance;
-            total_supply += itr->pending_fee;
-        }
+        FC_ASSERT(totals.total_supply <= asset::maximum(SCORUM_SYMBOL), "Assets SCR overflow");
+        FC_ASSERT(totals.total_scorumpower <= asset::maximum(SP_SYMBOL), "Assets SP overflow");
 
-        total_supply += obtain_service<dbs_reward_fund_scr>().get().activity_reward_balance;
-        total_supply += asset(obtain_service<dbs_reward_fund_sp>().get().activity_reward_balance.amount, SCORUM_SYMBOL);
+        FC_ASSERT(gpo.total_supply == totals.total_supply, "",
+                  ("gpo.total_supply", gpo.total_supply)("total_supply", totals.total_supply));
+        FC_ASSERT(gpo.total_scorumpower == totals.total_scorumpower, "",
+                  ("gpo.total_scorumpower", gpo.total_scorumpower)("total_scorumpower", totals.total_scorumpower));
+        FC_ASSERT(gpo.total_scorumpower.amount == totals.total_vsf_votes, "",
+                  ("total_scorumpower", gpo.total_scorumpower)("total_vsf_votes", totals.total_vsf_votes));
+    }
+    FC_CAPTURE_LOG_AND_RETHROW((head_block_num()));
+}
 
-        dbs_fifa_world_cup_2018_bounty_reward_fund& fifa_world_cup_2018_bounty_reward_fund_service
-            = obtain_service<dbs_fifa_world_cup_2018_bounty_reward_fund>();
-        if (fifa_world_cup_2018_bounty_reward_fund_service.is_exists())
+void database::validate_block_invariants() const
+{
+    try
+    {
+        // the invariants held before the block, so it's enough to check that the block changed the balances and the
+        // totals of the dynamic global properties by the same amounts
+        check_undo_state_visitor check_undo_state(*this, head_block_num());
+        for_each_supply_index(check_undo_state);
+
+        if (!check_undo_state.has_undo_state)
         {
-            total_supply += asset(fifa_world_cup_2018_bounty_reward_fund_service.get().activity_reward_balance.amount,
-                                  SCORUM_SYMBOL);
+            validate_invariants();
+            return;
         }
 
-        total_supply += asset(gpo.total_scorumpower.amount, SCORUM_SYMBOL);
-        total_supply += obtain_service<dbs_reward>().get().balance;
+        supply_totals added, removed;
+        supply_totals declared_added, declared_removed;
 
-        for (const budget_object& budget : obtain_service<dbs_budget>().get_budgets())
-        {
-            total_supply += budget.balance;
-        }
+        accumulate_changes_visitor accumulate_changes{ *this, added, removed };
+        for_each_supply_index(accumulate_changes);
 
-        if (obtain_service<dbs_budget>().is_fund_budget_exists())
-        {
-            total_supply += obtain_service<dbs_budget>().get_fund_budget().balance;
-        }
+        get_index<dynamic_global_property_index>().for_each_undo_change(
+            [&](const dynamic_global_property_object* old_obj, const dynamic_global_property_object* new_obj) {
+                if (old_obj)
+                    accumulate_declared(declared_removed, *old_obj);
+                if (new_obj)
+                    accumulate_declared(declared_added, *new_obj);
+            });
+
+        const auto& gpo = obtain_service<dbs_dynamic_global_property>().get();
 
-        if (obtain_service<dbs_registration_pool>().is_exists())
+        /// verify no witness has too many votes, the top one is enough
+        const auto& witness_idx = get_index<witness_index, by_vote_name>();
+        if (!witness_idx.empty())
         {
-            total_supply += obtain_service<dbs_registration_pool>().get().balance;
+            FC_ASSERT(witness_idx.begin()->votes <= gpo.total_scorumpower.amount, "${vs} > ${tvs}",
+                      ("vs", witness_idx.begin()->votes)("tvs", gpo.total_scorumpower.amount));
         }
 
-        total_supply += asset(obtain_service<dbs_dev_pool>().get().sp_balance.amount, SCORUM_SYMBOL);
-        total_supply += obtain_service<dbs_dev_pool>().get().scr_balance;
+        FC_ASSERT(gpo.total_supply <= asset::maximum(SCORUM_SYMBOL), "Assets SCR overflow");
+        FC_ASSERT(gpo.total_scorumpower <= asset::maximum(SP_SYMBOL), "Assets SP overflow");
 
-        const auto& atomicswap_contract_idx = get_index<atomicswap_contract_index, by_id>();
-        for (auto itr = atomicswap_contract_idx.begin(); itr != atomicswap_contract_idx.end(); ++itr)
-        {
-            total_supply += itr->amount;
-        }
+        const asset supply_delta = added.total_supply - removed.total_supply;
+        const asset declared_supply_delta = declared_added.total_supply - declared_removed.total_supply;
+        FC_ASSERT(declared_supply_delta == supply_delta, "",
+                  ("gpo.total_supply", declared_supply_delta)("total_supply", supply_delta));
 
-        FC_ASSERT(total_supply <= asset::maximum(SCORUM_SYMBOL), "Assets SCR overflow");
-        FC_ASSERT(total_scorumpower <= asset::maximum(SP_SYMBOL), "Assets SP overflow");
+        const asset scorumpower_delta = added.total_scorumpower - removed.total_scorumpower;
+        const asset declared_scorumpower_delta
+            = declared_added.total_scorumpower - declared_removed.total_scorumpower;
+        FC_ASSERT(declared_scorumpower_delta == scorumpower_delta, "",
+                  ("gpo.total_scorumpower", declared_scorumpower_delta)("total_scorumpower", scorumpower_delta));
 
-        FC_ASSERT(gpo.total_supply == total_supply, "",
-                  ("gpo.total_supply", gpo.total_supply)("total_supply", total_supply));
-        FC_ASSERT(gpo.total_scorumpower == total_scorumpower, "",
-                  ("gpo.total_scorumpower", gpo.total_scorumpower)("total_scorumpower", total_scorumpower));
-        FC_ASSERT(gpo.total_scorumpower.amount == total_vsf_votes, "",
-                  ("total_scorumpower", gpo.total_scorumpower)("total_vsf_votes", total_vsf_votes));
+        const share_type vsf_votes_delta = added.total_vsf_votes - removed.total_vsf_votes;
+        const share_type declared_vsf_votes_delta = declared_added.total_vsf_votes - declared_removed.total_vsf_votes;
+        FC_ASSERT(declared_vsf_votes_delta == vsf_votes_delta, "",
+                  ("total_scorumpower", declared_vsf_votes_delta)("total_vsf_votes", vsf_votes_delta));
     }
     FC_CAPTURE_LOG_AND_RETHROW((head_block_num()));
 }
 
+void database::set_invariants_audit_interval(uint32_t audit_blocks)
+{
+    _invariants_audit_blocks = audit_blocks;
+}
+
 } // namespace chain
 } // namespace scorum
@@ -38,7 +38,10 @@ void database::update_witness_schedule()
             }
 
             FC_ASSERT(active_witnesses.insert(std::make_pair(itr->id, itr->owner)).second);
-            _db.modify(*itr, [&](witness_object& wo) { wo.schedule = witness_object::top20; });
+
+            // the same witnesses stay in the top for many rounds, don't put their copies to the undo state
+            if (itr->schedule != witness_object::top20)
+                _db.modify(*itr, [&](witness_object& wo) { wo.schedule = witness_object::top20; });
         }
 
         /// Add the running witnesses in the lead
@@ -61,7 +64,9 @@ void database::update_witness_schedule()
             if (active_witnesses.find(sitr->id) == active_witnesses.end())
             {
                 FC_ASSERT(active_witnesses.insert(std::make_pair(sitr->id, sitr->owner)).second);
-                _db.modify(*sitr, [&](witness_object& wo) { wo.schedule = witness_object::timeshare; });
+
+                if (sitr->schedule != witness_object::timeshare)
+                    _db.modify(*sitr, [&](witness_object& wo) { wo.schedule = witness_object::timeshare; });
             }
         }
 
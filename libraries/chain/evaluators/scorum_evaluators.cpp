@@ -6,6 +6,7 @@
 #include <scorum/chain/services/witness.hpp>
 #include <scorum/chain/services/witness_vote.hpp>
 #include <scorum/chain/services/comment.hpp>
+#include <scorum/chain/services/comment_content.hpp>
 #include <scorum/chain/services/comment_vote.hpp>
 #include <scorum/chain/services/budget.hpp>
 #include <scorum/chain/services/registration_pool.hpp>
@@ -224,6 +225,7 @@ void delete_comment_evaluator::do_apply(const delete_comment_operation& o)
     account_service_i& account_service = db().account_service();
     comment_service_i& comment_service = db().comment_service();
     comment_vote_service_i& comment_vote_service = db().comment_vote_service();
+    comment_content_service_i& comment_content_service = db().comment_content_service();
     dynamic_global_property_service_i& dprops_service = db().dynamic_global_property_service();
 
     const auto& auth = account_service.get_account(o.author);
@@ -264,6 +266,7 @@ void delete_comment_evaluator::do_apply(const delete_comment_operation& o)
 #endif
     }
 
+    comment_content_service.remove_by_comment(comment.id);
     comment_service.remove(comment);
 }
 
@@ -333,6 +336,7 @@ void comment_evaluator::do_apply(const comment_operation& o)
     comment_service_i& comment_service = db().comment_service();
     comment_statistic_scr_service_i& comment_statistic_scr_service = db().comment_statistic_scr_service();
     comment_statistic_sp_service_i& comment_statistic_sp_service = db().comment_statistic_sp_service();
+    comment_content_service_i& comment_content_service = db().comment_content_service();
     dynamic_global_property_service_i& dprops_service = db().dynamic_global_property_service();
 
     try
@@ -425,19 +429,23 @@ void comment_evaluator::do_apply(const comment_operation& o)
                 }
 
                 com.cashout_time = com.created + SCORUM_CASHOUT_WINDOW_SECONDS;
+            });
 
 #ifndef IS_LOW_MEM
-                fc::from_string(com.title, o.title);
+            comment_content_service.create([&](comment_content_object& content) {
+                content.comment = new_comment.id;
+
+                fc::from_string(content.title, o.title);
                 if (o.body.size() < 1024 * 1024 * 128)
                 {
-                    fc::from_string(com.body, o.body);
+                    fc::from_string(content.body, o.body);
                 }
                 if (fc::is_utf8(o.json_metadata))
-                    fc::from_string(com.json_metadata, o.json_metadata);
+                    fc::from_string(content.json_metadata, o.json_metadata);
                 else
                     wlog("Comment ${a}/${p} contains invalid UTF-8 metadata", ("a", o.author)("p", o.permlink));
-#endif
             });
+#endif
 
             comment_statistic_scr_service.create(
                 [&](comment_statistic_scr_object& stat) { stat.comment = new_comment.id; });
@@ -493,14 +501,17 @@ void comment_evaluator::do_apply(const comment_operation& o)
                     FC_ASSERT(com.parent_author == o.parent_author, "The parent of a comment cannot be changed.");
                     FC_ASSERT(equal(com.parent_permlink, parent_permlink), "The permlink of a comment cannot change.");
                 }
+            });
 
 #ifndef IS_LOW_MEM
+            const comment_content_object& comment_content = comment_content_service.get(comment.id);
+            comment_content_service.update(comment_content, [&](comment_content_object& content) {
                 if (o.title.size())
-                    fc::from_string(com.title, o.title);
+                    fc::from_string(content.title, o.title);
                 if (o.json_metadata.size())
                 {
                     if (fc::is_utf8(o.json_metadata))
-                        fc::from_string(com.json_metadata, o.json_metadata);
+                        fc::from_string(content.json_metadata, o.json_metadata);
                     else
                         wlog("Comment ${a}/${p} contains invalid UTF-8 metadata", ("a", o.author)("p", o.permlink));
                 }
@@ -513,30 +524,30 @@ void comment_evaluator::do_apply(const comment_operation& o)
                         auto patch = dmp.patch_fromText(utf8_to_wstring(o.body));
                         if (patch.size())
                         {
-                            auto result = dmp.patch_apply(patch, utf8_to_wstring(fc::to_string(com.body)));
+                            auto result = dmp.patch_apply(patch, utf8_to_wstring(fc::to_string(content.body)));
                             auto patched_body = wstring_to_utf8(result.first);
                             if (!fc::is_utf8(patched_body))
                             {
                                 idump(("invalid utf8")(patched_body));
-                                fc::from_string(com.body, fc::prune_invalid_utf8(patched_body));
+                                fc::from_string(content.body, fc::prune_invalid_utf8(patched_body));
                             }
                             else
                             {
-                                fc::from_string(com.body, patched_body);
+                                fc::from_string(content.body, patched_body);
                             }
                         }
                         else
                         { // replace
-                            fc::from_string(com.body, o.body);
+                            fc::from_string(content.body, o.body);
                         }
                     }
                     catch (...)
                     {
-                        fc::from_string(com.body, o.body);
+                        fc::from_string(content.body, o.body);
                     }
                 }
-#endif
             });
+#endif
 
         } // end EDIT case
     }
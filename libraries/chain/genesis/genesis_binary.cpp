@@ -0,0 +1,104 @@
+#include <scorum/chain/genesis/genesis_binary.hpp>
+
+#include <fc/exception/exception.hpp>
+#include <fc/io/raw.hpp>
+
+#include <cstring>
+#include <fstream>
+
+namespace scorum {
+namespace chain {
+
+namespace {
+
+const char genesis_binary_magic[] = { 'S', 'C', 'R', 'G', 'E', 'N', '0', '1' };
+
+const size_t genesis_binary_buffer_size = 4 * 1024 * 1024;
+}
+
+bool is_binary_genesis(const fc::path& path)
+{
+    std::ifstream in(path.generic_string(), std::ios::in | std::ios::binary);
+
+    char magic[sizeof(genesis_binary_magic)] = {};
+    in.read(magic, sizeof(magic));
+
+    return in && std::memcmp(magic, genesis_binary_magic, sizeof(magic)) == 0;
+}
+
+void load_binary_genesis(const fc::path& path, genesis_state_type& genesis)
+{
+    try
+    {
+        std::vector<char> buffer(genesis_binary_buffer_size);
+
+        std::ifstream in;
+        in.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+        in.open(path.generic_string(), std::ios::in | std::ios::binary);
+
+        FC_ASSERT(in, "Can't read file ${p}.", ("p", path));
+
+        char magic[sizeof(genesis_binary_magic)] = {};
+        in.read(magic, sizeof(magic));
+
+        FC_ASSERT(in && std::memcmp(magic, genesis_binary_magic, sizeof(magic)) == 0,
+                  "File ${p} is not a binary genesis.", ("p", path));
+
+        fc::raw::unpack(in, genesis.initial_chain_id);
+        fc::raw::unpack(in, genesis);
+
+        FC_ASSERT(genesis.accounts.empty(), "Accounts must be stored after the genesis state.");
+
+        uint64_t accounts_count = 0;
+        fc::raw::unpack(in, accounts_count);
+
+        genesis.accounts.resize(accounts_count);
+        for (auto& account : genesis.accounts)
+            fc::raw::unpack(in, account);
+
+        FC_ASSERT(in, "Unexpected end of file ${p}.", ("p", path));
+    }
+    FC_CAPTURE_AND_RETHROW((path))
+}
+
+void save_binary_genesis(const fc::path& path, genesis_state_type& genesis)
+{
+    try
+    {
+        std::ofstream out(path.generic_string(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+        FC_ASSERT(out, "Can't write to file ${p}.", ("p", path));
+
+        out.write(genesis_binary_magic, sizeof(genesis_binary_magic));
+
+        fc::raw::pack(out, genesis.initial_chain_id);
+
+        // accounts are moved out for a while to pack the rest of the state without copying it
+        std::vector<genesis_state_type::account_type> accounts;
+        accounts.swap(genesis.accounts);
+
+        try
+        {
+            fc::raw::pack(out, genesis);
+
+            fc::raw::pack(out, (uint64_t)accounts.size());
+            for (const auto& account : accounts)
+                fc::raw::pack(out, account);
+        }
+        catch (...)
+        {
+            accounts.swap(genesis.accounts);
+            throw;
+        }
+
+        accounts.swap(genesis.accounts);
+
+        out.flush();
+
+        FC_ASSERT(out, "Can't write to file ${p}.", ("p", path));
+    }
+    FC_CAPTURE_AND_RETHROW((path))
+}
+
+} // namespace chain
+} // namespace scorum
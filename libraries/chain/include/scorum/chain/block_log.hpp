@@ -43,6 +43,26 @@ public:
     ~block_log();
 
     void open(const fc::path& file);
+
+    /**
+     * Opens the log written by another process. Nothing is written or reconstructed, the head is read
+     * by refresh_head() when the writer reports newer blocks.
+     */
+    void open_read_only(const fc::path& file);
+
+    /**
+     * Makes blocks up to block_num readable, block_num must be flushed by the writer.
+     * May be called by several threads, the head is read with positional reads, the streams are not used.
+     */
+    void refresh_head(uint32_t block_num) const;
+    bool is_read_only() const;
+
+    /**
+     * The last block available to read_block_by_num, it can be used concurrently with the writer and refresh_head
+     * unlike head().
+     */
+    uint32_t readable_head_num() const;
+
     void close();
     bool is_open() const;
 
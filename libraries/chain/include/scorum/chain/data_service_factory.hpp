@@ -9,6 +9,7 @@ DATA_SERVICE_FACTORY_DECLARE(
         (atomicswap)
         (budget)
         (comment)
+        (comment_content)
         (comment_statistic_scr)
         (comment_statistic_sp)
         (comment_vote)
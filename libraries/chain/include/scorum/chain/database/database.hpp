@@ -139,6 +139,12 @@ public:
     optional<signed_block> fetch_block_by_number(uint32_t num) const;
     optional<signed_block> read_block_by_number(uint32_t num) const;
 
+    /**
+     * Returns up to count consecutive blocks starting from first_block_num. Irreversible blocks are read from the block
+     * log sequentially, without looking up the position of every block.
+     */
+    std::vector<signed_block> fetch_block_range(uint32_t first_block_num, uint32_t count) const;
+
     const signed_transaction get_recent_transaction(const transaction_id_type& trx_id) const;
     std::vector<block_id_type> get_block_ids_on_fork(block_id_type head_of_fork) const;
 
@@ -189,6 +195,7 @@ public:
 
     void notify_pre_applied_block(const signed_block& block);
     void notify_applied_block(const signed_block& block);
+    void notify_popped_block(const signed_block& block);
     void notify_on_pending_transaction(const signed_transaction& tx);
     void notify_on_pre_apply_transaction(const signed_transaction& tx);
     void notify_on_applied_transaction(const signed_transaction& tx);
@@ -210,6 +217,12 @@ public:
      */
     fc::signal<void(const signed_block&)> applied_block;
 
+    /**
+     *  This signal is emitted after the changes of the head block have been undone
+     *  (the block is popped while switching to another fork).
+     */
+    fc::signal<void(const signed_block&)> popped_block;
+
     /**
      * This signal is emitted any time a new transaction is added to the pending
      * block state.
@@ -302,11 +315,33 @@ public:
        with id N, applies all hardforks with id <= N */
     void set_hardfork(uint32_t hardfork, bool process_now = true);
 
+    /**
+     * Recomputes total supply, total scorumpower and total vsf votes scanning all the balances and compares them with
+     * the dynamic global properties. It takes time proportional to the number of accounts.
+     */
     void validate_invariants() const;
 
+    /**
+     * The same checks as validate_invariants does, but only for the objects changed in the head block. Changes are
+     * taken from the undo state of the block, so it takes time proportional to the number of changes. Falls back to
+     * validate_invariants if the undo state of the block is already committed (irreversible).
+     */
+    void validate_block_invariants() const;
+
+    /**
+     * Runs full validate_invariants every audit_blocks blocks instead of validate_block_invariants (0 - never).
+     */
+    void set_invariants_audit_interval(uint32_t audit_blocks);
+
     void set_flush_interval(uint32_t flush_blocks);
     void show_free_memory(bool force);
 
+    /**
+     * Enables growth of the shared memory file between blocks. The file is extended by grow_step bytes
+     * when free memory drops below the half of grow_step, but not above max_size (0 means no limit).
+     */
+    void set_shared_file_growth(uint64_t grow_step, uint64_t max_size);
+
     // index
 
     template <typename MultiIndexType> void add_plugin_index()
@@ -329,6 +364,11 @@ private:
     void _maybe_warn_multiple_production(uint32_t height) const;
     bool _push_block(const signed_block& b);
 
+    // reads the head of the block log written by the writer process (in read only mode)
+    void sync_block_log() const;
+
+    void _grow_shared_memory_if_needed();
+
     signed_block _generate_block(const fc::time_point_sec when,
                                  const account_name_type& witness_owner,
                                  const fc::ecc::private_key& block_signing_private_key);
@@ -392,8 +432,13 @@ private:
     uint32_t _flush_blocks = 0;
     uint32_t _next_flush_block = 0;
 
+    uint32_t _invariants_audit_blocks = SCORUM_BLOCKS_PER_HOUR;
+
     uint32_t _last_free_gb_printed = 0;
 
+    uint64_t _shared_file_grow_step = 0;
+    uint64_t _shared_file_max_size = 0;
+
     fc::time_point_sec _const_genesis_time; // should be const
 };
 } // namespace chain
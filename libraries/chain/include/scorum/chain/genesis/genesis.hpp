@@ -17,7 +17,7 @@ public:
 
 private:
     database& _db;
-    genesis_state_type _genesis_state;
+    const genesis_state_type& _genesis_state;
 };
 
 } // namespace chain
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <scorum/chain/genesis/genesis_state.hpp>
+
+#include <fc/filesystem.hpp>
+
+namespace scorum {
+namespace chain {
+
+/**
+ * Binary genesis is the raw packed genesis_state_type preceded by a magic and the chain id. Accounts are written
+ * after the rest of the state one by one, so the number of accounts is not limited by the maximal size of a packed
+ * array and the file is read sequentially without building an intermediate json tree.
+ *
+ * The chain id is stored in the file because it is computed from the json representation of the genesis
+ * (see create_genesis).
+ */
+bool is_binary_genesis(const fc::path& path);
+
+void load_binary_genesis(const fc::path& path, genesis_state_type& genesis);
+
+void save_binary_genesis(const fc::path& path, genesis_state_type& genesis);
+
+} // namespace chain
+} // namespace scorum
@@ -24,7 +24,7 @@ class comment_object : public object<comment_object_type, comment_object>
 public:
     /// \cond DO_NOT_DOCUMENT
     CHAINBASE_DEFAULT_DYNAMIC_CONSTRUCTOR(
-        comment_object, (category)(parent_permlink)(permlink)(title)(body)(json_metadata)(beneficiaries))
+        comment_object, (category)(parent_permlink)(permlink)(beneficiaries))
 
     id_type id;
 
@@ -34,9 +34,6 @@ public:
     account_name_type author;
     fc::shared_string permlink;
 
-    fc::shared_string title;
-    fc::shared_string body;
-    fc::shared_string json_metadata;
     time_point_sec last_update;
     time_point_sec created;
 
@@ -89,6 +86,24 @@ public:
     fc::shared_vector<beneficiary_route_type> beneficiaries;
 };
 
+/**
+ * Title, body and metadata of the comment. They are not used by consensus after the comment operation, so they are
+ * kept apart from comment_object and are not copied to the undo state by votes and cashouts.
+ */
+class comment_content_object : public object<comment_content_object_type, comment_content_object>
+{
+public:
+    CHAINBASE_DEFAULT_DYNAMIC_CONSTRUCTOR(comment_content_object, (title)(body)(json_metadata))
+
+    id_type id;
+
+    comment_id_type comment;
+
+    fc::shared_string title;
+    fc::shared_string body;
+    fc::shared_string json_metadata;
+};
+
 /**
  * This index maintains the set of voter/comment pairs that have been used, voters cannot
  * vote on the same comment more than once per payout period.
@@ -312,6 +327,17 @@ using comment_statistic_index
 using comment_statistic_scr_index = comment_statistic_index<comment_statistic_scr_object>;
 using comment_statistic_sp_index = comment_statistic_index<comment_statistic_sp_object>;
 
+typedef shared_multi_index_container<comment_content_object,
+                                     indexed_by<ordered_unique<tag<by_id>,
+                                                               member<comment_content_object,
+                                                                      comment_content_id_type,
+                                                                      &comment_content_object::id>>,
+                                                ordered_unique<tag<by_comment_id>,
+                                                               member<comment_content_object,
+                                                                      comment_id_type,
+                                                                      &comment_content_object::comment>>>>
+    comment_content_index;
+
 } // namespace chain
 } // namespace scorum
 
@@ -320,7 +346,7 @@ using comment_statistic_sp_index = comment_statistic_index<comment_statistic_sp_
 FC_REFLECT( scorum::chain::comment_object,
              (id)(author)(permlink)
              (category)(parent_author)(parent_permlink)
-             (title)(body)(json_metadata)(last_update)(created)(active)(last_payout)
+             (last_update)(created)(active)(last_payout)
              (depth)(children)
              (net_rshares)(abs_rshares)(vote_rshares)
              (children_abs_rshares)(cashout_time)
@@ -329,6 +355,12 @@ FC_REFLECT( scorum::chain::comment_object,
              (beneficiaries)
           )
 CHAINBASE_SET_INDEX_TYPE( scorum::chain::comment_object, scorum::chain::comment_index )
+CHAINBASE_SET_DENSE_ID_INDEX( scorum::chain::comment_object )
+
+FC_REFLECT( scorum::chain::comment_content_object,
+             (id)(comment)(title)(body)(json_metadata)
+          )
+CHAINBASE_SET_INDEX_TYPE( scorum::chain::comment_content_object, scorum::chain::comment_content_index )
 
 FC_REFLECT( scorum::chain::comment_vote_object,
              (id)(voter)(comment)(weight)(rshares)(vote_percent)(last_update)(num_changes)
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <scorum/chain/services/service_base.hpp>
+#include <scorum/chain/schema/comment_objects.hpp>
+
+namespace scorum {
+namespace chain {
+
+struct comment_content_service_i : public base_service_i<comment_content_object>
+{
+    virtual const comment_content_object& get(const comment_id_type& comment_id) const = 0;
+
+    virtual const comment_content_object* find(const comment_id_type& comment_id) const = 0;
+
+    virtual void remove_by_comment(const comment_id_type& comment_id) = 0;
+};
+
+class dbs_comment_content : public dbs_service_base<comment_content_service_i>
+{
+    friend class dbservice_dbs_factory;
+
+protected:
+    explicit dbs_comment_content(database& db);
+
+public:
+    const comment_content_object& get(const comment_id_type& comment_id) const override;
+
+    const comment_content_object* find(const comment_id_type& comment_id) const override;
+
+    void remove_by_comment(const comment_id_type& comment_id) override;
+};
+} // namespace chain
+} // namespace scorum
@@ -1,12 +1,10 @@
 #pragma once
 
-#include <memory>
-#include <string>
-#include <typeinfo>
+#include <array>
+#include <atomic>
+#include <mutex>
 
 #include <boost/config.hpp>
-#include <boost/type_index.hpp>
-#include <boost/container/flat_map.hpp>
 
 namespace scorum {
 namespace chain {
@@ -16,8 +14,6 @@ class dbs_base;
 
 class dbservice_dbs_factory
 {
-    using BaseServicePtr = std::unique_ptr<dbs_base>;
-
 protected:
     dbservice_dbs_factory() = delete;
 
@@ -28,20 +24,41 @@ protected:
 public:
     template <typename ConcreteService> ConcreteService& obtain_service() const
     {
-        auto it = _dbs.find(boost::typeindex::type_id<ConcreteService>());
-        if (it == _dbs.end())
+        const size_t slot = service_slot<ConcreteService>();
+
+        // API threads obtain services too, a missing service is created once under the mutex
+        dbs_base* service = _dbs[slot].load(std::memory_order_acquire);
+        if (BOOST_UNLIKELY(!service))
         {
-            it = _dbs.insert(std::make_pair(boost::typeindex::type_id<ConcreteService>(),
-                                            BaseServicePtr(new ConcreteService(_db_core))))
-                     .first;
+            std::lock_guard<std::mutex> lock(_dbs_mutex);
+
+            service = _dbs[slot].load(std::memory_order_relaxed);
+            if (!service)
+            {
+                service = new ConcreteService(_db_core);
+                _dbs[slot].store(service, std::memory_order_release);
+            }
         }
 
-        BaseServicePtr& ret = it->second;
-        return static_cast<ConcreteService&>(*ret);
+        return static_cast<ConcreteService&>(*service);
     }
 
 private:
-    mutable boost::container::flat_map<boost::typeindex::type_index, BaseServicePtr> _dbs;
+    static const size_t max_services_count = 128;
+
+    // every service type gets its own slot number once per process, so obtaining the service is an array access
+    template <typename ConcreteService> static size_t service_slot()
+    {
+        static const size_t slot = new_service_slot();
+        return slot;
+    }
+
+    static size_t new_service_slot();
+
+    static std::atomic<size_t> _slots_count;
+
+    mutable std::array<std::atomic<dbs_base*>, max_services_count> _dbs;
+    mutable std::mutex _dbs_mutex;
     database& _db_core;
 };
 } // namespace chain
@@ -10,6 +10,20 @@ struct dynamic_global_property_service_i : public base_service_i<dynamic_global_
     virtual time_point_sec get_genesis_time() const = 0;
 
     virtual fc::time_point_sec head_block_time() const = 0;
+
+    // Block tasks change supply counters many times in a row. Such changes are combined into pending deltas
+    // which are written by flush_supply or together with the next update of the object through the service.
+    // get() returns the object as it is written, pending deltas are included by the supply getters.
+    virtual void accumulate_supply(const asset& circulating_capital, const asset& total_scorumpower) = 0;
+
+    virtual asset get_circulating_capital() const = 0;
+
+    virtual asset get_total_scorumpower() const = 0;
+
+    virtual void flush_supply() = 0;
+
+    // drops pending deltas if the block failed to apply, its state is undone
+    virtual void discard_supply() = 0;
 };
 
 class dbs_dynamic_global_property : public dbs_service_base<dynamic_global_property_service_i>
@@ -23,6 +37,55 @@ public:
     virtual time_point_sec get_genesis_time() const override;
 
     virtual fc::time_point_sec head_block_time() const override;
+
+    virtual void update(const modifier_type& modifier) override;
+
+    virtual void update(const dynamic_global_property_object& o, const modifier_type& modifier) override;
+
+    virtual void accumulate_supply(const asset& circulating_capital, const asset& total_scorumpower) override;
+
+    virtual asset get_circulating_capital() const override;
+
+    virtual asset get_total_scorumpower() const override;
+
+    virtual void flush_supply() override;
+
+    virtual void discard_supply() override;
+
+private:
+    void apply_pending_supply(dynamic_global_property_object& o);
+
+    asset _pending_circulating_capital = asset(0, SCORUM_SYMBOL);
+    asset _pending_total_scorumpower = asset(0, SP_SYMBOL);
+    bool _has_pending_supply = false;
+};
+
+/**
+ * Combines supply changes of a block, they are written by flush() or dropped if the block failed to apply
+ */
+class supply_batch_guard
+{
+public:
+    explicit supply_batch_guard(dynamic_global_property_service_i& service)
+        : _service(service)
+    {
+    }
+
+    ~supply_batch_guard()
+    {
+        if (!_flushed)
+            _service.discard_supply();
+    }
+
+    void flush()
+    {
+        _service.flush_supply();
+        _flushed = true;
+    }
+
+private:
+    dynamic_global_property_service_i& _service;
+    bool _flushed = false;
 };
 
 } // namespace chain
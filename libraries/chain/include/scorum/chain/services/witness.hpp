@@ -3,6 +3,8 @@
 #include <scorum/chain/services/service_base.hpp>
 #include <scorum/chain/schema/witness_objects.hpp>
 
+#include <map>
+
 namespace scorum {
 namespace protocol {
 class chain_properties;
@@ -21,6 +23,11 @@ struct witness_service_i : public base_service_i<witness_object>
 
     virtual const witness_object& get_top_witness() const = 0;
 
+    using witness_refs_type = std::vector<object_cref_type>;
+
+    /** returns up to `limit` witnesses ordered by owner name, starting from `lower_bound_name` */
+    virtual witness_refs_type get_witnesses_by_name(const std::string& lower_bound_name, uint32_t limit) const = 0;
+
     virtual const witness_object& create_witness(const account_name_type& owner,
                                                  const std::string& url,
                                                  const public_key_type& block_signing_key,
@@ -42,6 +49,19 @@ struct witness_service_i : public base_service_i<witness_object>
 
     /** this is called by `adjust_proxied_witness_votes` when account proxy to self */
     virtual void adjust_witness_votes(const account_object& account, const share_type& delta) = 0;
+
+    // While a block is applied vote changes are combined per witness and written by flush_witness_votes, so the
+    // witness indices are re-sorted once per witness instead of once per change. Out of a block votes are written
+    // at once.
+    virtual void begin_witness_votes_batch() = 0;
+
+    virtual void flush_witness_votes() = 0;
+
+    // writes combined changes and stops combining
+    virtual void end_witness_votes_batch() = 0;
+
+    // drops combined changes if the block failed to apply, its state is undone
+    virtual void discard_witness_votes_batch() = 0;
 };
 
 class dbs_witness : public dbs_service_base<witness_service_i>
@@ -58,6 +78,8 @@ public:
 
     const witness_object& get_top_witness() const override;
 
+    witness_refs_type get_witnesses_by_name(const std::string& lower_bound_name, uint32_t limit) const override;
+
     const witness_object& create_witness(const account_name_type& owner,
                                          const std::string& url,
                                          const public_key_type& block_signing_key,
@@ -77,8 +99,21 @@ public:
     /** this is called by `adjust_proxied_witness_votes` when account proxy to self */
     void adjust_witness_votes(const account_object& account, const share_type& delta) override;
 
+    void begin_witness_votes_batch() override;
+
+    void flush_witness_votes() override;
+
+    void end_witness_votes_batch() override;
+
+    void discard_witness_votes_batch() override;
+
 private:
     const witness_object& create_internal(const account_name_type& owner, const public_key_type& block_signing_key);
+
+    void write_witness_vote(const witness_object& witness, const share_type& delta);
+
+    bool _is_batch_open = false;
+    std::map<witness_id_type, share_type> _pending_votes;
 };
 } // namespace chain
 } // namespace scorum
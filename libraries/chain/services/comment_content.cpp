@@ -0,0 +1,40 @@
+#include <scorum/chain/services/comment_content.hpp>
+#include <scorum/chain/database/database.hpp>
+
+#include <scorum/chain/schema/comment_objects.hpp>
+
+namespace scorum {
+namespace chain {
+
+dbs_comment_content::dbs_comment_content(database& db)
+    : base_service_type(db)
+{
+}
+
+const comment_content_object& dbs_comment_content::get(const comment_id_type& comment_id) const
+{
+    try
+    {
+        return get_by<by_comment_id>(comment_id);
+    }
+    FC_CAPTURE_AND_RETHROW((comment_id))
+}
+
+const comment_content_object* dbs_comment_content::find(const comment_id_type& comment_id) const
+{
+    try
+    {
+        return find_by<by_comment_id>(comment_id);
+    }
+    FC_CAPTURE_AND_RETHROW((comment_id))
+}
+
+void dbs_comment_content::remove_by_comment(const comment_id_type& comment_id)
+{
+    const comment_content_object* content = find(comment_id);
+    if (content)
+        db_impl().remove(*content);
+}
+
+} // namespace chain
+} // namespace scorum
@@ -2,18 +2,33 @@
 #include <scorum/chain/services/dbs_base.hpp>
 #include <scorum/chain/database/database.hpp>
 
+#include <fc/exception/exception.hpp>
+
 namespace scorum {
 namespace chain {
 
 // dbservice_dbs_factory
 
+std::atomic<size_t> dbservice_dbs_factory::_slots_count(0);
+
 dbservice_dbs_factory::dbservice_dbs_factory(database& db)
     : _db_core(db)
 {
+    for (auto& service : _dbs)
+        service.store(nullptr);
 }
 
 dbservice_dbs_factory::~dbservice_dbs_factory()
 {
+    for (auto& service : _dbs)
+        delete service.load();
+}
+
+size_t dbservice_dbs_factory::new_service_slot()
+{
+    const size_t slot = _slots_count++;
+    FC_ASSERT(slot < max_services_count, "Too many service types, increase max_services_count");
+    return slot;
 }
 }
 }
@@ -22,5 +22,68 @@ fc::time_point_sec dbs_dynamic_global_property::head_block_time() const
     return get().time;
 }
 
+void dbs_dynamic_global_property::update(const modifier_type& modifier)
+{
+    // pending deltas are written by the same modify
+    base_service_type::update([&](dynamic_global_property_object& o) {
+        apply_pending_supply(o);
+        modifier(o);
+    });
+}
+
+void dbs_dynamic_global_property::update(const dynamic_global_property_object& o, const modifier_type& modifier)
+{
+    base_service_type::update(o, [&](dynamic_global_property_object& obj) {
+        apply_pending_supply(obj);
+        modifier(obj);
+    });
+}
+
+void dbs_dynamic_global_property::accumulate_supply(const asset& circulating_capital, const asset& total_scorumpower)
+{
+    FC_ASSERT(circulating_capital.symbol() == SCORUM_SYMBOL, "Invalid asset type (symbol) for circulating capital.");
+    FC_ASSERT(total_scorumpower.symbol() == SP_SYMBOL, "Invalid asset type (symbol) for total scorumpower.");
+
+    _pending_circulating_capital += circulating_capital;
+    _pending_total_scorumpower += total_scorumpower;
+    _has_pending_supply = true;
+}
+
+asset dbs_dynamic_global_property::get_circulating_capital() const
+{
+    return get().circulating_capital + _pending_circulating_capital;
+}
+
+asset dbs_dynamic_global_property::get_total_scorumpower() const
+{
+    return get().total_scorumpower + _pending_total_scorumpower;
+}
+
+void dbs_dynamic_global_property::flush_supply()
+{
+    if (!_has_pending_supply)
+        return;
+
+    base_service_type::update([&](dynamic_global_property_object& o) { apply_pending_supply(o); });
+}
+
+void dbs_dynamic_global_property::discard_supply()
+{
+    _pending_circulating_capital = asset(0, SCORUM_SYMBOL);
+    _pending_total_scorumpower = asset(0, SP_SYMBOL);
+    _has_pending_supply = false;
+}
+
+void dbs_dynamic_global_property::apply_pending_supply(dynamic_global_property_object& o)
+{
+    if (!_has_pending_supply)
+        return;
+
+    o.circulating_capital += _pending_circulating_capital;
+    o.total_scorumpower += _pending_total_scorumpower;
+
+    discard_supply();
+}
+
 } // namespace scorum
 } // namespace chain
@@ -37,6 +37,19 @@ const witness_object& dbs_witness::get_top_witness() const
     return (*idx.begin());
 }
 
+dbs_witness::witness_refs_type dbs_witness::get_witnesses_by_name(const std::string& lower_bound_name,
+                                                                 uint32_t limit) const
+{
+    witness_refs_type result;
+    result.reserve(limit);
+
+    const auto& idx = db_impl().get_index<witness_index>().indices().get<by_name>();
+    for (auto itr = idx.lower_bound(lower_bound_name); limit-- && itr != idx.end(); ++itr)
+        result.push_back(std::cref(*itr));
+
+    return result;
+}
+
 const witness_object& dbs_witness::create_witness(const account_name_type& owner,
                                                   const std::string& url,
                                                   const public_key_type& block_signing_key,
@@ -102,7 +115,52 @@ void dbs_witness::adjust_witness_votes(const account_object& account, const shar
 
 void dbs_witness::adjust_witness_vote(const witness_object& witness, const share_type& delta)
 {
-    const auto& props = db_impl().obtain_service<dbs_dynamic_global_property>().get();
+    if (_is_batch_open)
+    {
+        // a zero sum is written too, the witness position is updated by any change like it was before batching
+        _pending_votes[witness.id] += delta;
+        return;
+    }
+
+    write_witness_vote(witness, delta);
+}
+
+void dbs_witness::begin_witness_votes_batch()
+{
+    FC_ASSERT(!_is_batch_open, "Witness votes batch is already open.");
+
+    _is_batch_open = true;
+}
+
+void dbs_witness::flush_witness_votes()
+{
+    // the virtual time is not changed between the flushes, so a single write per witness gives the same position as
+    // writing every change
+    std::map<witness_id_type, share_type> pending_votes;
+    pending_votes.swap(_pending_votes);
+
+    for (const auto& vote : pending_votes)
+    {
+        write_witness_vote(db_impl().get(vote.first), vote.second);
+    }
+}
+
+void dbs_witness::end_witness_votes_batch()
+{
+    flush_witness_votes();
+
+    _is_batch_open = false;
+}
+
+void dbs_witness::discard_witness_votes_batch()
+{
+    _pending_votes.clear();
+    _is_batch_open = false;
+}
+
+void dbs_witness::write_witness_vote(const witness_object& witness, const share_type& delta)
+{
+    const asset total_scorumpower = db_impl().obtain_service<dbs_dynamic_global_property>().get_total_scorumpower();
 
     const witness_schedule_object& wso = db_impl().obtain_service<dbs_witness_schedule>().get();
     update(witness, [&](witness_object& w) {
@@ -111,8 +169,7 @@ void dbs_witness::adjust_witness_vote(const witness_object& witness, const share
 
         w.virtual_last_update = wso.current_virtual_time;
         w.votes += delta;
-        FC_ASSERT(w.votes <= props.total_scorumpower.amount, "",
-                  ("w.votes", w.votes)("props", props.total_scorumpower));
+        FC_ASSERT(w.votes <= total_scorumpower.amount, "", ("w.votes", w.votes)("props", total_scorumpower));
 
         w.virtual_scheduled_time
             = w.virtual_last_update + (VIRTUAL_SCHEDULE_LAP_LENGTH - w.virtual_position) / (w.votes.value + 1);
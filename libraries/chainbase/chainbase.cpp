@@ -3,6 +3,9 @@
 #define SHARED_MEMORY_FILE "shared_memory.bin"
 #define SHARED_MEMORY_META_FILE "shared_memory.meta"
 
+// the name is changed with the layout of read_write_mutex_manager
+#define SHARED_MEMORY_RW_MANAGER "rw_manager_v2"
+
 namespace chainbase {
 
 database::~database()
@@ -19,7 +22,15 @@ void database::check_dir_existance(const boost::filesystem::path& dir, bool read
     boost::filesystem::create_directories(dir);
 }
 
-void database::create_meta_file(const boost::filesystem::path& file)
+void database::lock_meta_file(const boost::filesystem::path& file)
+{
+    // closing of any descriptor of the file releases the locks of the process, so it's locked after it's mapped
+    _flock = boost::interprocess::file_lock(file.generic_string().c_str());
+    if (!_flock.try_lock())
+        BOOST_THROW_EXCEPTION(std::runtime_error("could not gain write access to the shared memory file"));
+}
+
+void database::create_meta_file(const boost::filesystem::path& file, bool read_only)
 {
     ilog("Try to open meta file in read/write mode");
 
@@ -28,15 +39,33 @@ void database::create_meta_file(const boost::filesystem::path& file)
         _meta.reset(new boost::interprocess::managed_mapped_file(boost::interprocess::open_only,
                                                                  file.generic_string().c_str()));
 
-        set_read_write_mutex_manager(_meta->find<read_write_mutex_manager>("rw_manager").first);
-    }
-    else
-    {
-        _meta.reset(new boost::interprocess::managed_mapped_file(
-            boost::interprocess::create_only, file.generic_string().c_str(), sizeof(read_write_mutex_manager) * 2));
+        // the file of a running writer must not be removed below
+        if (!read_only)
+            lock_meta_file(file);
+
+        auto rw_manager = _meta->find<read_write_mutex_manager>(SHARED_MEMORY_RW_MANAGER).first;
+        if (rw_manager)
+        {
+            set_read_write_mutex_manager(rw_manager);
+            return;
+        }
+
+        if (read_only)
+            BOOST_THROW_EXCEPTION(std::runtime_error("shared memory meta file has the layout of the previous "
+                                                     "version, start the writer node of this version first"));
 
-        set_read_write_mutex_manager(_meta->find_or_construct<read_write_mutex_manager>("rw_manager")());
+        // meta file of the previous layout keeps nothing but the locks, the writer creates it again
+        _meta.reset();
+        boost::filesystem::remove(file);
     }
+
+    _meta.reset(new boost::interprocess::managed_mapped_file(
+        boost::interprocess::create_only, file.generic_string().c_str(), sizeof(read_write_mutex_manager) * 2));
+
+    if (!read_only)
+        lock_meta_file(file);
+
+    set_read_write_mutex_manager(_meta->find_or_construct<read_write_mutex_manager>(SHARED_MEMORY_RW_MANAGER)());
 }
 
 void database::open(const boost::filesystem::path& dir, uint32_t flags, uint64_t shared_file_size)
@@ -52,15 +81,10 @@ void database::open(const boost::filesystem::path& dir, uint32_t flags, uint64_t
 
     create_segment_file(boost::filesystem::absolute(dir / SHARED_MEMORY_FILE), read_only, shared_file_size);
 
-    create_meta_file(boost::filesystem::absolute(dir / SHARED_MEMORY_META_FILE));
+    // the writer takes the lock on the meta file as well
+    create_meta_file(boost::filesystem::absolute(dir / SHARED_MEMORY_META_FILE), read_only);
 
-    // create lock on meta file
-    if (!read_only)
-    {
-        _flock = boost::interprocess::file_lock((dir / SHARED_MEMORY_META_FILE).generic_string().c_str());
-        if (!_flock.try_lock())
-            BOOST_THROW_EXCEPTION(std::runtime_error("could not gain write access to the shared memory file"));
-    }
+    _segment_generation = _rw_manager->segment_generation();
 }
 
 void database::flush()
@@ -71,6 +95,56 @@ void database::flush()
         _meta->flush();
 }
 
+void database::grow(uint64_t size_increment)
+{
+    // readers of this process may still hold the read lock moved away from by the timed out write lock
+    boost::unique_lock<boost::shared_mutex> segment_lock(_segment_mutex);
+
+    const char* old_address = static_cast<const char*>(get_segment_address());
+
+    bool grown = grow_segment_file(size_increment);
+
+    rebase_indexes(old_address);
+
+    if (!grown)
+        BOOST_THROW_EXCEPTION(std::runtime_error("could not grow database file"));
+
+    // read only processes remap the file on the next read lock
+    _rw_manager->next_segment_generation();
+    _segment_generation = _rw_manager->segment_generation();
+}
+
+void database::remap_segment()
+{
+    const void* old_address = get_segment_address();
+
+    remap_segment_file();
+
+    rebase_indexes(old_address);
+}
+
+void database::rebase_indexes(const void* old_address)
+{
+    // indexes keep their offsets in the segment, only the address it's mapped to may change
+    const char* new_address = static_cast<const char*>(get_segment_address());
+    for (auto& item : _index_map)
+    {
+        item.second = const_cast<char*>(new_address)
+            + (static_cast<const char*>(item.second) - static_cast<const char*>(old_address));
+        set_index_slot(item.first, item.second);
+    }
+}
+
+uint32_t database::published_block_num() const
+{
+    return _rw_manager ? _rw_manager->published_block_num() : 0;
+}
+
+void database::publish_block_num(uint32_t block_num)
+{
+    _rw_manager->publish_block_num(block_num);
+}
+
 void database::close()
 {
     close_segment_file();
@@ -86,6 +160,7 @@ void database::wipe()
     boost::filesystem::remove_all(dir / SHARED_MEMORY_FILE);
     boost::filesystem::remove_all(dir / SHARED_MEMORY_META_FILE);
     _index_map.clear();
+    _index_slots.clear();
 }
 
 } // namespace chainbase
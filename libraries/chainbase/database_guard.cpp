@@ -5,9 +5,21 @@
 
 namespace chainbase {
 
+namespace {
+thread_local uint64_t thread_read_lock_wait_micro = 0;
+
+uint64_t microseconds_since(const std::chrono::steady_clock::time_point& start)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+}
+
 read_write_mutex_manager::read_write_mutex_manager()
 {
     _current_lock = 0;
+    _write_generation = 0;
+    _segment_generation = 0;
+    _published_block_num = 0;
 }
 
 read_write_mutex_manager::~read_write_mutex_manager()
@@ -30,11 +42,68 @@ uint32_t read_write_mutex_manager::current_lock_num()
     return _current_lock;
 }
 
+uint64_t read_write_mutex_manager::write_generation() const
+{
+    return _write_generation;
+}
+
+void read_write_mutex_manager::next_write_generation()
+{
+    ++_write_generation;
+}
+
+uint64_t read_write_mutex_manager::segment_generation() const
+{
+    return _segment_generation;
+}
+
+void read_write_mutex_manager::next_segment_generation()
+{
+    ++_segment_generation;
+}
+
+uint32_t read_write_mutex_manager::published_block_num() const
+{
+    return _published_block_num;
+}
+
+void read_write_mutex_manager::publish_block_num(uint32_t block_num)
+{
+    _published_block_num = block_num;
+}
+
 //////////////////////////////////////////////////////////////////////////
+thread_local int32_t database_guard::_read_lock_count = 0;
+thread_local int32_t database_guard::_write_lock_count = 0;
+
 database_guard::~database_guard()
 {
 }
 
+void database_guard::remap_segment()
+{
+}
+
+void database_guard::add_read_lock_wait(const std::chrono::steady_clock::time_point& wait_start)
+{
+    const uint64_t wait = microseconds_since(wait_start);
+
+    ++_read_locks_taken;
+    _read_lock_wait_micro += wait;
+    thread_read_lock_wait_micro += wait;
+}
+
+void database_guard::add_write_lock_wait(const std::chrono::steady_clock::time_point& wait_start)
+{
+    ++_write_locks_taken;
+    _write_lock_wait_micro += microseconds_since(wait_start);
+}
+
+uint64_t database_guard::thread_read_lock_wait_microseconds()
+{
+    return thread_read_lock_wait_micro;
+}
+
 void database_guard::set_require_locking(bool enable_require_locking)
 {
     _enable_require_locking = enable_require_locking;
@@ -17,7 +17,13 @@ class database : public undo_db_state
 
 private:
     void check_dir_existance(const boost::filesystem::path& dir, bool read_only);
-    void create_meta_file(const boost::filesystem::path& file);
+    void lock_meta_file(const boost::filesystem::path& file);
+    void create_meta_file(const boost::filesystem::path& file, bool read_only);
+
+    void rebase_indexes(const void* old_address);
+
+protected:
+    virtual void remap_segment() override;
 
 public:
     virtual ~database();
@@ -32,6 +38,19 @@ public:
     void close();
     void flush();
     void wipe();
+
+    /**
+    * Extends the shared memory file by size_increment bytes without closing the database.
+    * Must be called under the write lock at a point where no references to the objects are held.
+    * Open undo sessions stay valid, they find their indexes by type id.
+    */
+    void grow(uint64_t size_increment);
+
+    /**
+    * The last block written to the block log by the writer process, read only processes don't look for newer blocks.
+    */
+    uint32_t published_block_num() const;
+    void publish_block_num(uint32_t block_num);
 };
 
 } // namespace chainbase
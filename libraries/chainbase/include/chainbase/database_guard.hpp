@@ -2,11 +2,13 @@
 
 #include <atomic>
 #include <array>
+#include <chrono>
 #include <typeinfo>
 
 #include <boost/interprocess/sync/interprocess_sharable_mutex.hpp>
 #include <boost/interprocess/sync/sharable_lock.hpp>
 #include <boost/thread/locks.hpp>
+#include <boost/thread/shared_mutex.hpp>
 
 #include <fc/exception/exception.hpp>
 #include <fc/scoped_increment.hpp>
@@ -25,6 +27,10 @@ typedef boost::interprocess::sharable_lock<read_write_mutex> read_lock;
 typedef boost::unique_lock<read_write_mutex> write_lock;
 
 //////////////////////////////////////////////////////////////////////////
+/**
+* Lives in the meta file, so the locks and the counters are shared by the writer process and all read-only processes
+* which map the same database.
+*/
 class read_write_mutex_manager
 {
 public:
@@ -35,9 +41,28 @@ public:
     read_write_mutex& current_lock();
     uint32_t current_lock_num();
 
+    uint64_t write_generation() const;
+    void next_write_generation();
+
+    /**
+    * Is incremented by the writer every time the segment file is grown, readers remap the file when it changes.
+    */
+    uint64_t segment_generation() const;
+    void next_segment_generation();
+
+    /**
+    * The last block which is completely written to the block log by the writer.
+    */
+    uint32_t published_block_num() const;
+    void publish_block_num(uint32_t block_num);
+
 private:
     std::array<read_write_mutex, CHAINBASE_NUM_RW_LOCKS> _locks;
     std::atomic<uint32_t> _current_lock;
+
+    std::atomic<uint64_t> _write_generation;
+    std::atomic<uint64_t> _segment_generation;
+    std::atomic<uint32_t> _published_block_num;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -46,13 +71,69 @@ class database_guard
 protected:
     read_write_mutex_manager* _rw_manager = nullptr;
 
-    int32_t _read_lock_count = 0;
-    int32_t _write_lock_count = 0;
+    // locks held by the current thread, checked by require_read_lock and require_write_lock
+    static thread_local int32_t _read_lock_count;
+    static thread_local int32_t _write_lock_count;
     bool _enable_require_locking = false;
 
+    // generation of the segment file mapped by this process, see read_write_mutex_manager::segment_generation
+    uint64_t _segment_generation = 0;
+
+    // is taken exclusively by the thread which grows or remaps the segment, readers of this process hold it shared
+    boost::shared_mutex _segment_mutex;
+
+    // time spent by the threads of this process waiting for the locks
+    std::atomic<uint64_t> _read_locks_taken{ 0 };
+    std::atomic<uint64_t> _read_lock_wait_micro{ 0 };
+    std::atomic<uint64_t> _write_locks_taken{ 0 };
+    std::atomic<uint64_t> _write_lock_wait_micro{ 0 };
+
+    void add_read_lock_wait(const std::chrono::steady_clock::time_point& wait_start);
+    void add_write_lock_wait(const std::chrono::steady_clock::time_point& wait_start);
+
+    /**
+    * Maps the segment file again after it was grown by the writer process.
+    */
+    virtual void remap_segment();
+
 public:
     virtual ~database_guard();
 
+    /**
+    * Is incremented every time the write lock is taken (by any process). While it stays the same, the state observed
+    * under the read lock is not changed, so everything computed from it can be reused.
+    */
+    uint64_t write_generation() const
+    {
+        return _rw_manager ? _rw_manager->write_generation() : 0;
+    }
+
+    uint64_t read_locks_taken() const
+    {
+        return _read_locks_taken;
+    }
+
+    uint64_t read_lock_wait_microseconds() const
+    {
+        return _read_lock_wait_micro;
+    }
+
+    uint64_t write_locks_taken() const
+    {
+        return _write_locks_taken;
+    }
+
+    uint64_t write_lock_wait_microseconds() const
+    {
+        return _write_lock_wait_micro;
+    }
+
+    /**
+    * Total time the current thread waited for read locks. The difference of two calls is the wait of the code
+    * executed between them (e.g. of an API call).
+    */
+    static uint64_t thread_read_lock_wait_microseconds();
+
     void set_require_locking(bool enable_require_locking);
 
     void require_lock_fail(const char* method, const char* lock_type, const char* tname) const;
@@ -71,6 +152,8 @@ public:
         read_lock lock(_rw_manager->current_lock(), boost::interprocess::defer_lock_type());
         SCOPED_INCREMENT(_read_lock_count);
 
+        const auto wait_start = std::chrono::steady_clock::now();
+
         if (!wait_micro)
         {
             lock.lock();
@@ -82,6 +165,25 @@ public:
                 BOOST_THROW_EXCEPTION(std::runtime_error("unable to acquire lock"));
         }
 
+        add_read_lock_wait(wait_start);
+
+        boost::shared_lock<boost::shared_mutex> segment_lock(_segment_mutex);
+
+        if (BOOST_UNLIKELY(_segment_generation != _rw_manager->segment_generation()))
+        {
+            // the writer can't grow the file again while the read lock is held
+            segment_lock.unlock();
+            {
+                boost::unique_lock<boost::shared_mutex> remap_lock(_segment_mutex);
+                if (_segment_generation != _rw_manager->segment_generation())
+                {
+                    remap_segment();
+                    _segment_generation = _rw_manager->segment_generation();
+                }
+            }
+            segment_lock.lock();
+        }
+
         return callback();
     }
 
@@ -96,6 +198,8 @@ public:
         write_lock lock(_rw_manager->current_lock(), boost::defer_lock_t());
         SCOPED_INCREMENT(_write_lock_count);
 
+        const auto wait_start = std::chrono::steady_clock::now();
+
         if (!wait_micro)
         {
             lock.lock();
@@ -111,6 +215,10 @@ public:
             }
         }
 
+        add_write_lock_wait(wait_start);
+
+        _rw_manager->next_write_generation();
+
         return callback();
     }
 };
@@ -2,6 +2,8 @@
 
 #include <boost/container/flat_map.hpp>
 
+#include <vector>
+
 #include <chainbase/chain_object.hpp>
 #include <chainbase/database_guard.hpp>
 #include <chainbase/generic_index.hpp>
@@ -36,6 +38,7 @@ public:
         idx_ptr->validate();
 
         _index_map[type_id] = idx_ptr;
+        set_index_slot(type_id, idx_ptr);
 
         return *idx_ptr;
     }
@@ -43,56 +46,26 @@ public:
     template <typename MultiIndexType> bool has_index() const
     {
         CHAINBASE_REQUIRE_READ_LOCK(typename MultiIndexType::value_type);
-        typedef generic_index<MultiIndexType> index_type;
-        return _index_map.find((uint16_t)index_type::value_type::type_id) != _index_map.end();
+        return nullptr != find_index<MultiIndexType>();
     }
 
     template <typename MultiIndexType> const generic_index<MultiIndexType>& get_index() const
     {
         CHAINBASE_REQUIRE_READ_LOCK(typename MultiIndexType::value_type);
-        typedef generic_index<MultiIndexType> index_type;
-        typedef index_type* index_type_ptr;
-
-        if (!has_index<MultiIndexType>())
-        {
-            std::string type_name = boost::core::demangle(typeid(typename index_type::value_type).name());
-            BOOST_THROW_EXCEPTION(std::runtime_error("unable to find index for " + type_name + " in database"));
-        }
-
-        return *index_type_ptr(_index_map.find((uint16_t)index_type::value_type::type_id)->second);
+        return get_index_ref<MultiIndexType>();
     }
 
     template <typename MultiIndexType, typename ByIndex>
     auto get_index() const -> decltype(((generic_index<MultiIndexType>*)(nullptr))->indices().template get<ByIndex>())
     {
         CHAINBASE_REQUIRE_READ_LOCK(typename MultiIndexType::value_type);
-        typedef generic_index<MultiIndexType> index_type;
-        typedef index_type* index_type_ptr;
-
-        if (!has_index<MultiIndexType>())
-        {
-            std::string type_name = boost::core::demangle(typeid(typename index_type::value_type).name());
-            BOOST_THROW_EXCEPTION(std::runtime_error("unable to find index for " + type_name + " in database"));
-        }
-
-        return index_type_ptr(_index_map.find((uint16_t)index_type::value_type::type_id)->second)
-            ->indices()
-            .template get<ByIndex>();
+        return get_index_ref<MultiIndexType>().indices().template get<ByIndex>();
     }
 
     template <typename MultiIndexType> generic_index<MultiIndexType>& get_mutable_index()
     {
         CHAINBASE_REQUIRE_WRITE_LOCK(typename MultiIndexType::value_type);
-        typedef generic_index<MultiIndexType> index_type;
-        typedef index_type* index_type_ptr;
-
-        if (!has_index<MultiIndexType>())
-        {
-            std::string type_name = boost::core::demangle(typeid(typename index_type::value_type).name());
-            BOOST_THROW_EXCEPTION(std::runtime_error("unable to find index for " + type_name + " in database"));
-        }
-
-        return *index_type_ptr(_index_map.find((uint16_t)index_type::value_type::type_id)->second);
+        return get_index_ref<MultiIndexType>();
     }
 
     template <typename ObjectType, typename IndexedByType, typename CompatibleKey>
@@ -111,11 +84,7 @@ public:
     {
         CHAINBASE_REQUIRE_READ_LOCK(ObjectType);
         typedef typename get_index_type<ObjectType>::type index_type;
-        const auto& idx = get_index<index_type>().indices();
-        auto itr = idx.find(key);
-        if (itr == idx.end())
-            return nullptr;
-        return &*itr;
+        return get_index<index_type>().find_by_id(key);
     }
 
     template <typename ObjectType, typename IndexedByType, typename CompatibleKey>
@@ -167,9 +136,46 @@ public:
     }
 
 protected:
+    void set_index_slot(uint16_t type_id, void* idx_ptr)
+    {
+        if (type_id >= _index_slots.size())
+            _index_slots.resize(type_id + 1, nullptr);
+
+        _index_slots[type_id] = idx_ptr;
+    }
+
     /**
-    * This is a full map (size 2^16) of all possible index designed for constant time lookup
+    * All added indexes ordered by type id, used to iterate over indexes
     */
     boost::container::flat_map<uint16_t, void*> _index_map;
+
+    /**
+    * Indexes by type id, lookup of the index takes a single load instead of searching in the _index_map
+    */
+    std::vector<void*> _index_slots;
+
+private:
+    template <typename MultiIndexType> generic_index<MultiIndexType>* find_index() const
+    {
+        typedef generic_index<MultiIndexType> index_type;
+
+        const uint16_t type_id = index_type::value_type::type_id;
+        if (type_id >= _index_slots.size())
+            return nullptr;
+
+        return static_cast<index_type*>(_index_slots[type_id]);
+    }
+
+    template <typename MultiIndexType> generic_index<MultiIndexType>& get_index_ref() const
+    {
+        auto idx_ptr = find_index<MultiIndexType>();
+        if (!idx_ptr)
+        {
+            std::string type_name = boost::core::demangle(typeid(typename MultiIndexType::value_type).name());
+            BOOST_THROW_EXCEPTION(std::runtime_error("unable to find index for " + type_name + " in database"));
+        }
+
+        return *idx_ptr;
+    }
 };
 }
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <boost/interprocess/offset_ptr.hpp>
 #include <boost/throw_exception.hpp>
 #include <stdexcept>
+#include <type_traits>
 
 #include <fc/shared_containers.hpp>
 
@@ -9,6 +11,17 @@
 
 namespace chainbase {
 
+/**
+*  Specialize it with CHAINBASE_SET_DENSE_ID_INDEX for the objects which are mostly looked up by id.
+*  Index of such objects keeps pointers to the nodes in a chunked array indexed by id, so lookup by id takes
+*  constant time instead of walking the tree. The array covers ids from the oldest to the newest existing object,
+*  slots of objects removed in between are kept empty. So it suits objects which are rarely removed or which are
+*  removed from the oldest ones (history pruning).
+*/
+template <typename T> struct has_dense_id_index : public std::false_type
+{
+};
+
 /**
 *  The value_type stored in the multiindex container must have a integer field with the name 'id'.  This will
 *  be the primary key and it will be assigned and managed by generic_index.
@@ -20,10 +33,12 @@ template <typename MultiIndexType> class base_index
 public:
     using value_type = typename MultiIndexType::value_type;
     using allocator_type = typename MultiIndexType::allocator_type;
+    using id_type = typename value_type::id_type;
 
     template <typename Allocator>
     base_index(const Allocator& a)
         : _indices(a)
+        , _dense_ids(a)
         , _size_of_value_type(sizeof(typename MultiIndexType::node_type))
         , _size_of_this(sizeof(*this))
     {
@@ -56,6 +71,25 @@ public:
         return *ptr;
     }
 
+    const value_type* find_by_id(const id_type& id) const
+    {
+        if (!has_dense_id_index<value_type>::value)
+            return find(id);
+
+        if (id._id < _dense_ids_begin || uint64_t(id._id - _dense_ids_begin) >= _dense_ids.size())
+            return nullptr;
+
+        return _dense_ids[(size_t)(id._id - _dense_ids_begin)].get();
+    }
+
+    const value_type& get_by_id(const id_type& id) const
+    {
+        auto ptr = find_by_id(id);
+        if (!ptr)
+            BOOST_THROW_EXCEPTION(std::out_of_range("key not found"));
+        return *ptr;
+    }
+
 protected:
     /**
     * Construct a new element in the shared_multi_index_container.
@@ -87,6 +121,8 @@ protected:
 
     void remove(const value_type& obj)
     {
+        remove_dense_id(obj.id);
+
         _indices.erase(_indices.iterator_to(obj));
     }
 
@@ -105,12 +141,58 @@ protected:
                 std::logic_error("could not insert object, most likely a uniqueness constraint was violated"));
         }
 
+        insert_dense_id(*insert_result.first);
+
         return *insert_result.first;
     }
 
+private:
+    // nodes of multi index container do not move, so pointers stay valid until the object is removed
+    void insert_dense_id(const value_type& v)
+    {
+        if (!has_dense_id_index<value_type>::value)
+            return;
+
+        if (_dense_ids.empty())
+            _dense_ids_begin = v.id._id;
+
+        // undo restores the removed oldest objects
+        if (v.id._id < _dense_ids_begin)
+        {
+            _dense_ids.insert(_dense_ids.begin(), (size_t)(_dense_ids_begin - v.id._id), nullptr);
+            _dense_ids_begin = v.id._id;
+        }
+
+        const size_t pos = (size_t)(v.id._id - _dense_ids_begin);
+        if (pos >= _dense_ids.size())
+            _dense_ids.resize(pos + 1);
+
+        _dense_ids[pos] = &v;
+    }
+
+    void remove_dense_id(const id_type& id)
+    {
+        if (!has_dense_id_index<value_type>::value)
+            return;
+
+        _dense_ids[(size_t)(id._id - _dense_ids_begin)] = nullptr;
+
+        // objects created last are removed by undo and the oldest ones by pruning, empty slots are not kept at the ends
+        while (!_dense_ids.empty() && !_dense_ids.back())
+            _dense_ids.pop_back();
+
+        while (!_dense_ids.empty() && !_dense_ids.front())
+        {
+            _dense_ids.pop_front();
+            ++_dense_ids_begin;
+        }
+    }
+
 protected:
     typename value_type::id_type _next_id = 0;
     MultiIndexType _indices;
+    fc::shared_deque<boost::interprocess::offset_ptr<const value_type>> _dense_ids;
+    int64_t _dense_ids_begin = 0; ///< id of the first slot of _dense_ids
     uint32_t _size_of_value_type = 0;
     uint32_t _size_of_this = 0;
 };
@@ -181,6 +263,36 @@ public:
         base_index_type::remove(obj);
     }
 
+    /**
+    *  Returns true if the changes of the given revision are kept in the head of the undo buffer (the session of the
+    *  revision is not committed or squashed yet).
+    */
+    bool has_undo_state(int64_t revision) const
+    {
+        return enabled() && _stack.back().revision == revision;
+    }
+
+    /**
+    *  Calls visitor(old_value, new_value) for each object changed in the head of the undo buffer. old_value is nullptr
+    *  for the created objects and new_value is nullptr for the removed ones.
+    */
+    template <typename Visitor> void for_each_undo_change(Visitor&& visitor) const
+    {
+        if (!enabled())
+            return;
+
+        const auto& head = _stack.back();
+
+        for (const auto& item : head.old_values)
+            visitor(&item.second, &this->get_by_id(item.first));
+
+        for (const auto& id : head.new_ids)
+            visitor(static_cast<const value_type*>(nullptr), &this->get_by_id(id));
+
+        for (const auto& item : head.removed_values)
+            visitor(&item.second, static_cast<const value_type*>(nullptr));
+    }
+
 private:
     // abstract_generic_index_i interface
     abstract_undo_session_ptr start_undo_session() override
@@ -205,12 +317,13 @@ private:
 
         for (auto& item : head.old_values)
         {
-            base_index_type::modify(this->get(item.second.id), [&](value_type& v) { v = std::move(item.second); });
+            base_index_type::modify(this->get_by_id(item.second.id),
+                                    [&](value_type& v) { v = std::move(item.second); });
         }
 
         for (auto id : head.new_ids)
         {
-            base_index_type::remove(this->get(id));
+            base_index_type::remove(this->get_by_id(id));
         }
 
         this->_next_id = head.old_next_id;
@@ -451,6 +564,16 @@ template <typename T> struct get_index_type
 
 } // namespace chainbase
 
+/**
+*  This macro must be used at global scope and OBJECT_TYPE must be fully qualified
+*/
+#define CHAINBASE_SET_DENSE_ID_INDEX(OBJECT_TYPE)                                                                      \
+    namespace chainbase {                                                                                              \
+    template <> struct has_dense_id_index<OBJECT_TYPE> : public std::true_type                                         \
+    {                                                                                                                  \
+    };                                                                                                                 \
+    }
+
 /**
 *  This macro must be used at global scope and OBJECT_TYPE and INDEX_TYPE must be fully qualified
 */
@@ -13,6 +13,8 @@ protected:
 
     std::unique_ptr<boost::interprocess::managed_mapped_file> _segment;
 
+    boost::filesystem::path _segment_file;
+
 public:
     size_t get_free_memory() const;
 
@@ -25,6 +27,21 @@ protected:
 
     void close_segment_file();
 
+    const void* get_segment_address() const;
+
+    /**
+    * Unmaps the segment, extends the file by size_increment bytes and maps it again.
+    * The segment is remapped even if growing has failed, the result is returned to the caller.
+    * All pointers to the objects in the segment become invalid.
+    */
+    bool grow_segment_file(uint64_t size_increment);
+
+    /**
+    * Maps the read only segment again to see the file grown by the writer process.
+    * All pointers to the objects in the segment become invalid.
+    */
+    void remap_segment_file();
+
     template <typename index_type> index_type* allocate_index()
     {
         std::string type_name = boost::core::demangle(typeid(typename index_type::value_type).name());
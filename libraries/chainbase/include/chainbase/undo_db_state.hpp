@@ -19,5 +19,11 @@ public:
     }
 
     abstract_undo_session_ptr start_undo_session();
+
+private:
+    friend struct session_container;
+
+    // is used by the session destructor, so it doesn't throw
+    abstract_generic_index_i* find_index_by_type_id(uint16_t type_id);
 };
 }
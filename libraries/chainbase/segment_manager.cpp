@@ -45,6 +45,8 @@ void segment_manager::create_segment_file(const boost::filesystem::path& file,
 {
     ilog("Try to open segment file");
 
+    _segment_file = file;
+
     if (boost::filesystem::exists(file))
     {
         if (read_only)
@@ -92,6 +94,39 @@ void segment_manager::flush_segment_file()
 void segment_manager::close_segment_file()
 {
     _segment.reset();
+    _segment_file = boost::filesystem::path();
+}
+
+const void* segment_manager::get_segment_address() const
+{
+    FC_ASSERT(_segment);
+    return _segment->get_address();
+}
+
+bool segment_manager::grow_segment_file(uint64_t size_increment)
+{
+    FC_ASSERT(_segment);
+    FC_ASSERT(!_read_only, "could not grow read only database file");
+
+    _segment->flush();
+    _segment.reset();
+
+    bool grown = boost::interprocess::managed_mapped_file::grow(_segment_file.generic_string().c_str(), size_increment);
+
+    _segment.reset(new boost::interprocess::managed_mapped_file(boost::interprocess::open_only,
+                                                                _segment_file.generic_string().c_str()));
+
+    return grown;
+}
+
+void segment_manager::remap_segment_file()
+{
+    FC_ASSERT(_segment);
+    FC_ASSERT(_read_only, "only read only database file is remapped");
+
+    _segment.reset();
+    _segment.reset(new boost::interprocess::managed_mapped_file(boost::interprocess::open_read_only,
+                                                                _segment_file.generic_string().c_str()));
 }
 
 size_t segment_manager::get_free_memory() const
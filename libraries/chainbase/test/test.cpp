@@ -7,7 +7,10 @@
 #include <boost/multi_index/ordered_index.hpp>
 #include <boost/multi_index/member.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <thread>
 
 using namespace boost::multi_index;
 
@@ -30,6 +33,20 @@ typedef fc::shared_multi_index_container<book,
 
 CHAINBASE_SET_INDEX_TYPE(book, book_index)
 
+struct page : public chainbase::object<1, page>
+{
+    CHAINBASE_DEFAULT_CONSTRUCTOR(page)
+
+    id_type id;
+    int number = 0;
+};
+
+typedef fc::shared_multi_index_container<page, indexed_by<ordered_unique<member<page, page::id_type, &page::id>>>>
+    page_index;
+
+CHAINBASE_SET_INDEX_TYPE(page, page_index)
+CHAINBASE_SET_DENSE_ID_INDEX(page)
+
 class moc_database : public chainbase::database
 {
     typedef chainbase::database _Base;
@@ -146,4 +163,420 @@ BOOST_AUTO_TEST_CASE(open_and_create)
     }
 }
 
+BOOST_AUTO_TEST_CASE(grow_opened_database)
+{
+    boost::filesystem::path temp = boost::filesystem::unique_path();
+    try
+    {
+        moc_database db;
+        db.open(temp, chainbase::database::read_write, 1024 * 1024 * 8);
+        db.add_index<book_index>();
+
+        for (int i = 0; i < 100; ++i)
+        {
+            db.create<book>([&](book& b) { b.a = i; });
+        }
+
+        auto session = db.start_undo_session();
+        db.modify(db.get(book::id_type(0)), [&](book& b) { b.a = 1000; });
+        session->push();
+
+        const size_t old_size = db.get_size();
+        const size_t old_free_memory = db.get_free_memory();
+
+        db.grow(1024 * 1024 * 8);
+
+        BOOST_CHECK_EQUAL(db.get_size(), old_size + 1024 * 1024 * 8);
+        BOOST_CHECK_GT(db.get_free_memory(), old_free_memory);
+
+        BOOST_REQUIRE_EQUAL(db.get_index<book_index>().indices().size(), 100u);
+        BOOST_REQUIRE_EQUAL(db.get(book::id_type(0)).a, 1000);
+        BOOST_REQUIRE_EQUAL(db.get(book::id_type(99)).a, 99);
+
+        db.undo();
+        BOOST_REQUIRE_EQUAL(db.get(book::id_type(0)).a, 0);
+
+        db.create<book>([&](book& b) { b.a = 100; });
+        BOOST_REQUIRE_EQUAL(db.get(book::id_type(100)).a, 100);
+
+        {
+            // the session is open while the file is grown, then it is undone
+            auto open_session = db.start_undo_session();
+            db.modify(db.get(book::id_type(1)), [&](book& b) { b.a = 2000; });
+            db.create<book>([&](book& b) { b.a = 101; });
+
+            db.grow(1024 * 1024 * 8);
+
+            BOOST_REQUIRE_EQUAL(db.get(book::id_type(1)).a, 2000);
+            BOOST_REQUIRE_EQUAL(db.get(book::id_type(101)).a, 101);
+        }
+
+        BOOST_REQUIRE_EQUAL(db.get(book::id_type(1)).a, 1);
+        BOOST_REQUIRE(db.find(book::id_type(101)) == nullptr);
+        BOOST_REQUIRE_EQUAL(db.get_index<book_index>().indices().size(), 101u);
+
+        db.close();
+        boost::filesystem::remove_all(temp);
+    }
+    catch (...)
+    {
+        boost::filesystem::remove_all(temp);
+        throw;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(dense_id_index)
+{
+    boost::filesystem::path temp = boost::filesystem::unique_path();
+    try
+    {
+        moc_database db;
+        db.open(temp, chainbase::database::read_write, 1024 * 1024 * 8);
+        db.add_index<page_index>();
+
+        for (int i = 0; i < 10; ++i)
+        {
+            db.create<page>([&](page& p) { p.number = i; });
+        }
+
+        BOOST_REQUIRE_EQUAL(db.get(page::id_type(5)).number, 5);
+        BOOST_CHECK(db.find(page::id_type(10)) == nullptr);
+        BOOST_CHECK(db.find(page::id_type(-1)) == nullptr);
+
+        db.remove(db.get(page::id_type(5)));
+        BOOST_CHECK(db.find(page::id_type(5)) == nullptr);
+        BOOST_REQUIRE_EQUAL(db.get(page::id_type(9)).number, 9);
+
+        {
+            auto session = db.start_undo_session();
+
+            db.remove(db.get(page::id_type(3)));
+            db.modify(db.get(page::id_type(4)), [&](page& p) { p.number = 40; });
+            db.create<page>([&](page& p) { p.number = 10; });
+
+            BOOST_CHECK(db.find(page::id_type(3)) == nullptr);
+            BOOST_REQUIRE_EQUAL(db.get(page::id_type(4)).number, 40);
+            BOOST_REQUIRE_EQUAL(db.get(page::id_type(10)).number, 10);
+        }
+
+        BOOST_REQUIRE_EQUAL(db.get(page::id_type(3)).number, 3);
+        BOOST_REQUIRE_EQUAL(db.get(page::id_type(4)).number, 4);
+        BOOST_CHECK(db.find(page::id_type(10)) == nullptr);
+
+        const auto& created = db.create<page>([&](page& p) { p.number = 11; });
+        BOOST_CHECK(created.id == page::id_type(10));
+        BOOST_CHECK(&db.get(page::id_type(10)) == &created);
+
+        db.close();
+        boost::filesystem::remove_all(temp);
+    }
+    catch (...)
+    {
+        boost::filesystem::remove_all(temp);
+        throw;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(dense_id_index_pruned_from_front)
+{
+    boost::filesystem::path temp = boost::filesystem::unique_path();
+    try
+    {
+        moc_database db;
+        db.open(temp, chainbase::database::read_write, 1024 * 1024 * 8);
+        db.add_index<page_index>();
+
+        // objects are created at the end and the oldest ones are pruned, like history
+        auto append_and_prune = [&](int count) {
+            for (int i = 0; i < count; ++i)
+            {
+                db.create<page>([&](page& p) { p.number = i; });
+            }
+
+            const auto& idx = db.get_index<page_index>().indices();
+            while (idx.size() > 10)
+            {
+                db.remove(*idx.begin());
+            }
+        };
+
+        append_and_prune(10000);
+        const size_t free_memory = db.get_free_memory();
+
+        for (int cycle = 0; cycle < 10; ++cycle)
+            append_and_prune(10000);
+
+        // slots of the pruned objects are released, without it 8 bytes per object would be lost
+        BOOST_CHECK_LT(free_memory - std::min(free_memory, db.get_free_memory()), 10000u * sizeof(void*));
+
+        const int64_t last_id = 11 * 10000 - 1;
+        BOOST_CHECK(db.find(page::id_type(last_id - 10)) == nullptr);
+        BOOST_REQUIRE_EQUAL(db.get(page::id_type(last_id - 9)).number, 10000 - 10);
+        BOOST_REQUIRE_EQUAL(db.get(page::id_type(last_id)).number, 10000 - 1);
+
+        {
+            auto session = db.start_undo_session();
+
+            db.remove(db.get(page::id_type(last_id - 9)));
+            db.remove(db.get(page::id_type(last_id - 8)));
+
+            BOOST_CHECK(db.find(page::id_type(last_id - 8)) == nullptr);
+        }
+
+        // undo restores the pruned objects in front of the first slot
+        BOOST_REQUIRE_EQUAL(db.get(page::id_type(last_id - 9)).number, 10000 - 10);
+        BOOST_REQUIRE_EQUAL(db.get(page::id_type(last_id - 8)).number, 10000 - 9);
+        BOOST_CHECK(&db.get(page::id_type(last_id - 9)) == &*db.get_index<page_index>().indices().begin());
+
+        db.close();
+        boost::filesystem::remove_all(temp);
+    }
+    catch (...)
+    {
+        boost::filesystem::remove_all(temp);
+        throw;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(undo_changes_of_head_revision)
+{
+    boost::filesystem::path temp = boost::filesystem::unique_path();
+    try
+    {
+        moc_database db;
+        db.open(temp, chainbase::database::read_write, 1024 * 1024 * 8);
+        db.add_index<page_index>();
+
+        for (int i = 0; i < 3; ++i)
+        {
+            db.create<page>([&](page& p) { p.number = i; });
+        }
+
+        const auto& idx = db.get_index<page_index>();
+
+        BOOST_CHECK(!idx.has_undo_state(1));
+
+        auto session = db.start_undo_session();
+
+        BOOST_CHECK(idx.has_undo_state(1));
+        BOOST_CHECK(!idx.has_undo_state(2));
+
+        db.modify(db.get(page::id_type(0)), [&](page& p) { p.number = 10; });
+        db.modify(db.get(page::id_type(0)), [&](page& p) { p.number = 20; });
+        db.remove(db.get(page::id_type(1)));
+        db.create<page>([&](page& p) { p.number = 3; });
+
+        int old_sum = 0;
+        int new_sum = 0;
+        int changes = 0;
+        idx.for_each_undo_change([&](const page* old_value, const page* new_value) {
+            if (old_value)
+                old_sum += old_value->number;
+            if (new_value)
+                new_sum += new_value->number;
+            ++changes;
+        });
+
+        BOOST_CHECK_EQUAL(changes, 3);
+        BOOST_CHECK_EQUAL(old_sum, 0 + 1);
+        BOOST_CHECK_EQUAL(new_sum, 20 + 3);
+
+        session.reset();
+
+        BOOST_CHECK(!idx.has_undo_state(1));
+
+        db.close();
+        boost::filesystem::remove_all(temp);
+    }
+    catch (...)
+    {
+        boost::filesystem::remove_all(temp);
+        throw;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(read_only_replica_follows_writer)
+{
+    boost::filesystem::path temp = boost::filesystem::unique_path();
+    try
+    {
+        moc_database writer;
+        writer.open(temp, chainbase::database::read_write, 1024 * 1024 * 8);
+        writer.add_index<book_index>();
+
+        writer.with_write_lock([&]() {
+            for (int i = 0; i < 100; ++i)
+            {
+                writer.create<book>([&](book& b) { b.a = i; });
+            }
+        });
+
+        moc_database reader;
+        reader.open(temp, chainbase::database::read_only);
+        reader.add_index<book_index>();
+
+        const uint64_t generation = reader.write_generation();
+
+        reader.with_read_lock([&]() { BOOST_REQUIRE_EQUAL(reader.get_index<book_index>().indices().size(), 100u); });
+
+        writer.with_write_lock([&]() {
+            writer.grow(1024 * 1024 * 8);
+
+            for (int i = 100; i < 200; ++i)
+            {
+                writer.create<book>([&](book& b) { b.a = i; });
+            }
+
+            writer.publish_block_num(2);
+        });
+
+        BOOST_CHECK_GT(reader.write_generation(), generation);
+        BOOST_CHECK_EQUAL(reader.published_block_num(), 2u);
+
+        reader.with_read_lock([&]() {
+            BOOST_REQUIRE_EQUAL(reader.get_index<book_index>().indices().size(), 200u);
+            BOOST_REQUIRE_EQUAL(reader.get(book::id_type(199)).a, 199);
+        });
+
+        reader.close();
+        writer.close();
+        boost::filesystem::remove_all(temp);
+    }
+    catch (...)
+    {
+        boost::filesystem::remove_all(temp);
+        throw;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(meta_file_of_previous_layout_is_recreated_by_writer)
+{
+    boost::filesystem::path temp = boost::filesystem::unique_path();
+    try
+    {
+        {
+            moc_database writer;
+            writer.open(temp, chainbase::database::read_write, 1024 * 1024 * 8);
+            writer.close();
+        }
+
+        // the meta file without the manager of the current layout
+        const boost::filesystem::path meta_file = temp / "shared_memory.meta";
+        boost::filesystem::remove(meta_file);
+        boost::interprocess::managed_mapped_file(boost::interprocess::create_only, meta_file.generic_string().c_str(),
+                                                 1024);
+
+        moc_database reader;
+        BOOST_CHECK_THROW(reader.open(temp, chainbase::database::read_only), std::runtime_error);
+        reader.close();
+
+        moc_database writer;
+        writer.open(temp, chainbase::database::read_write, 1024 * 1024 * 8);
+
+        reader.open(temp, chainbase::database::read_only);
+        BOOST_CHECK_EQUAL(reader.write_generation(), writer.write_generation());
+
+        reader.close();
+        writer.close();
+        boost::filesystem::remove_all(temp);
+    }
+    catch (...)
+    {
+        boost::filesystem::remove_all(temp);
+        throw;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(grow_while_reading_in_another_thread)
+{
+    boost::filesystem::path temp = boost::filesystem::unique_path();
+    try
+    {
+        moc_database db;
+        db.open(temp, chainbase::database::read_write, 1024 * 1024 * 8);
+        db.add_index<book_index>();
+
+        for (int i = 0; i < 100; ++i)
+        {
+            db.create<book>([&](book& b) { b.a = i; });
+        }
+
+        const size_t old_size = db.get_size();
+
+        std::atomic<bool> stop{ false };
+        std::atomic<int> reads{ 0 };
+        std::atomic<int> wrong{ 0 };
+
+        // the grow is done without the write lock as after the write lock timeout, only the segment mutex
+        // separates it from the readers of this process
+        std::thread reader([&]() {
+            while (!stop || reads == 0)
+            {
+                db.with_read_lock([&]() {
+                    for (int i = 0; i < 100; ++i)
+                    {
+                        if (db.get(book::id_type(i)).a != i)
+                            ++wrong;
+                    }
+                });
+                ++reads;
+            }
+        });
+
+        for (int i = 0; i < 5; ++i)
+        {
+            db.grow(1024 * 1024 * 8);
+        }
+
+        stop = true;
+        reader.join();
+
+        BOOST_CHECK_EQUAL(wrong, 0);
+        BOOST_CHECK_EQUAL(db.get_size(), old_size + 5 * 1024 * 1024 * 8);
+        BOOST_REQUIRE_EQUAL(db.get(book::id_type(99)).a, 99);
+
+        db.close();
+        boost::filesystem::remove_all(temp);
+    }
+    catch (...)
+    {
+        boost::filesystem::remove_all(temp);
+        throw;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(lock_wait_statistics)
+{
+    boost::filesystem::path temp = boost::filesystem::unique_path();
+    try
+    {
+        moc_database db;
+        db.open(temp, chainbase::database::read_write, 1024 * 1024 * 8);
+        db.add_index<book_index>();
+
+        const uint64_t read_locks = db.read_locks_taken();
+        const uint64_t write_locks = db.write_locks_taken();
+        const uint64_t thread_wait = chainbase::database_guard::thread_read_lock_wait_microseconds();
+
+        db.with_write_lock([&]() { db.create<book>([&](book& b) { b.a = 1; }); });
+        db.with_read_lock([&]() { BOOST_REQUIRE_EQUAL(db.get_index<book_index>().indices().size(), 1u); });
+        db.with_read_lock([&]() {});
+
+        BOOST_CHECK_EQUAL(db.read_locks_taken(), read_locks + 2);
+        BOOST_CHECK_EQUAL(db.write_locks_taken(), write_locks + 1);
+
+        // the wait of the process includes the waits of its threads
+        BOOST_CHECK_GE(db.read_lock_wait_microseconds(),
+                       chainbase::database_guard::thread_read_lock_wait_microseconds() - thread_wait);
+
+        db.close();
+        boost::filesystem::remove_all(temp);
+    }
+    catch (...)
+    {
+        boost::filesystem::remove_all(temp);
+        throw;
+    }
+}
+
 // BOOST_AUTO_TEST_SUITE_END()
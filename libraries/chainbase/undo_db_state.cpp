@@ -1,37 +1,88 @@
 #include <chainbase/undo_db_state.hpp>
 #include <chainbase/database_index.hpp>
 
+#include <fc/exception/exception.hpp>
+#include <fc/log/logger.hpp>
+
 namespace chainbase {
 
 //////////////////////////////////////////////////////////////////////////
+/**
+* Keeps type ids instead of references to the indexes, the indexes are looked up when the session is undone.
+* So the session stays valid when the segment is mapped to another address (see database::grow).
+*/
 struct session_container : public abstract_undo_session
 {
-    abstract_undo_session_list _session_list;
+    undo_db_state& _db;
+    std::vector<uint16_t> _type_ids;
+    bool _pushed = false;
 
 private:
     friend class undo_db_state;
 
 public:
-    session_container(abstract_undo_session_list&& s)
-        : _session_list(std::move(s))
+    session_container(undo_db_state& db, std::vector<uint16_t>&& type_ids)
+        : _db(db)
+        , _type_ids(std::move(type_ids))
     {
     }
 
+    ~session_container()
+    {
+        if (!_pushed)
+        {
+            for (uint16_t type_id : _type_ids)
+            {
+                abstract_generic_index_i* index = _db.find_index_by_type_id(type_id);
+                if (!index)
+                {
+                    elog("Index of type ${t} is not found, its session is not undone", ("t", type_id));
+                    continue;
+                }
+
+                try
+                {
+                    index->undo();
+                }
+                catch (const fc::exception& e)
+                {
+                    elog("Failed to undo index of type ${t}: ${e}", ("t", type_id)("e", e.to_detail_string()));
+                }
+                catch (const std::exception& e)
+                {
+                    elog("Failed to undo index of type ${t}: ${e}", ("t", type_id)("e", e.what()));
+                }
+            }
+        }
+    }
+
     virtual void push() override
     {
-        for (auto& i : _session_list)
-            i->push();
+        _pushed = true;
     }
 };
 
 //////////////////////////////////////////////////////////////////////////
 abstract_undo_session_ptr undo_db_state::start_undo_session()
 {
-    abstract_undo_session_list sub_sessions;
-    sub_sessions.reserve(_index_map.size());
+    std::vector<uint16_t> type_ids;
+    type_ids.reserve(_index_map.size());
 
-    for_each_index([&](abstract_generic_index_i& item) { sub_sessions.push_back(item.start_undo_session()); });
+    for (auto& item : _index_map)
+    {
+        // the undo state is kept by the index, the session only decides whether to undo it
+        static_cast<abstract_generic_index_i*>(item.second)->start_undo_session()->push();
+        type_ids.push_back(item.first);
+    }
 
-    return std::move(abstract_undo_session_ptr(new session_container(std::move(sub_sessions))));
+    return std::move(abstract_undo_session_ptr(new session_container(*this, std::move(type_ids))));
+}
+
+abstract_generic_index_i* undo_db_state::find_index_by_type_id(uint16_t type_id)
+{
+    auto itr = _index_map.find(type_id);
+    if (itr == _index_map.end())
+        return nullptr;
+    return static_cast<abstract_generic_index_i*>(itr->second);
 }
 }
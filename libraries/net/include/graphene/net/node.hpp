@@ -187,6 +187,95 @@ struct peer_status
     fc::variant_object info;
 };
 
+/**
+ *  Counters of a connected peer, see node::get_statistics
+ */
+struct peer_statistics
+{
+    fc::optional<fc::ip::endpoint> host;
+    node_id_t node_id;
+    std::string user_agent;
+    bool inbound = false;
+    fc::time_point connection_time;
+
+    uint64_t bytes_sent = 0;
+    uint64_t bytes_received = 0;
+
+    /** messages waiting in the send queue of the connection */
+    uint32_t send_queue_messages = 0;
+    uint64_t send_queue_bytes = 0;
+
+    /** measured with the current time request sent when the connection is established */
+    int64_t round_trip_delay_us = 0;
+    int64_t clock_offset_us = 0;
+
+    /** time between requesting an item (block or transaction) from the peer during normal operation and receiving it */
+    uint32_t items_received = 0;
+    uint64_t item_fetch_latency_sum_us = 0;
+    uint64_t item_fetch_latency_max_us = 0;
+
+    /** requests waiting for the reply of the peer */
+    uint32_t items_requested = 0;
+    uint32_t sync_items_requested = 0;
+
+    /** sync items the peer has told us about (or will tell) which are not requested yet */
+    uint32_t sync_items_to_get = 0;
+
+    bool we_need_sync_items_from_peer = false;
+    bool peer_needs_sync_items_from_us = false;
+
+    uint32_t head_block_number = 0;
+};
+
+/**
+ *  State of the blockchain synchronization, see node::get_statistics
+ */
+struct sync_statistics
+{
+    /** true while any of the peers has sync items we need */
+    bool is_syncing = false;
+
+    uint32_t unfetched_items = 0;
+    uint32_t active_requests = 0;
+
+    /** received blocks which can't be processed until the earlier blocks come */
+    uint32_t received_items = 0;
+
+    /** items to fetch during normal operation */
+    uint32_t items_to_fetch = 0;
+};
+
+/**
+ *  Time spent in a node_delegate method, the histogram has a counter for each bound of
+ *  node_statistics::delegate_call_histogram_bounds_us and one more for the calls above the last bound
+ */
+struct delegate_call_statistics
+{
+    std::string method;
+    uint64_t calls = 0;
+
+    uint64_t execution_sum_us = 0;
+    int64_t execution_max_us = 0;
+    std::vector<uint64_t> execution_histogram;
+
+    /** time waiting for the delegate thread before the call and for the p2p thread after it */
+    uint64_t delay_before_sum_us = 0;
+    uint64_t delay_after_sum_us = 0;
+};
+
+struct node_statistics
+{
+    std::vector<peer_statistics> peers;
+    sync_statistics sync;
+
+    /** average of the last minute */
+    uint32_t upload_bytes_per_second = 0;
+    uint32_t download_bytes_per_second = 0;
+
+    std::vector<uint64_t> delegate_call_histogram_bounds_us;
+    std::vector<delegate_call_statistics> delegate_calls;
+};
+
 /**
  *  @class node
  *  @brief provides application independent P2P broadcast and data synchronization
@@ -298,6 +387,11 @@ public:
     void disable_peer_advertising();
     fc::variant_object get_call_statistics() const;
 
+    /**
+     * Counters of the connected peers, of the synchronization and of the node delegate calls in structured form
+     */
+    node_statistics get_statistics() const;
+
 private:
     std::unique_ptr<detail::node_impl, detail::node_impl_deleter> my;
 };
@@ -335,3 +429,16 @@ typedef std::shared_ptr<simulated_network> simulated_network_ptr;
 
 FC_REFLECT(graphene::net::message_propagation_data, (received_time)(validated_time)(originating_peer))
 FC_REFLECT(graphene::net::peer_status, (version)(host)(info))
+FC_REFLECT(graphene::net::peer_statistics,
+           (host)(node_id)(user_agent)(inbound)(connection_time)(bytes_sent)(bytes_received)(send_queue_messages)(
+               send_queue_bytes)(round_trip_delay_us)(clock_offset_us)(items_received)(item_fetch_latency_sum_us)(
+               item_fetch_latency_max_us)(items_requested)(sync_items_requested)(sync_items_to_get)(
+               we_need_sync_items_from_peer)(peer_needs_sync_items_from_us)(head_block_number))
+FC_REFLECT(graphene::net::sync_statistics,
+           (is_syncing)(unfetched_items)(active_requests)(received_items)(items_to_fetch))
+FC_REFLECT(graphene::net::delegate_call_statistics,
+           (method)(calls)(execution_sum_us)(execution_max_us)(execution_histogram)(delay_before_sum_us)(
+               delay_after_sum_us))
+FC_REFLECT(graphene::net::node_statistics,
+           (peers)(sync)(upload_bytes_per_second)(download_bytes_per_second)(delegate_call_histogram_bounds_us)(
+               delegate_calls))
@@ -274,6 +274,9 @@ public:
 
     item_to_time_map_type items_requested_from_peer; /// items we've requested from this peer during normal operation.
     /// fetch from another peer if this peer disconnects
+    uint32_t items_received_from_peer; /// items requested during normal operation which the peer has sent
+    fc::microseconds item_fetch_latency_sum; /// time between requesting these items and receiving them
+    fc::microseconds item_fetch_latency_max;
     /// @}
 
     // if they're flooding us with transactions, we set this to avoid fetching for a few seconds to let the
@@ -323,6 +326,12 @@ public:
     fc::ip::endpoint get_local_endpoint();
     void set_remote_endpoint(fc::optional<fc::ip::endpoint> new_remote_endpoint);
 
+    size_t get_queued_messages_count() const;
+    size_t get_total_queued_messages_size() const;
+
+    /// accounts the time the item requested from this peer during normal operation took to come
+    void item_received(const fc::time_point& request_time);
+
     bool busy() const;
     bool idle() const;
     bool is_currently_handling_message() const;
@@ -29,6 +29,7 @@
 #include <forward_list>
 #include <iostream>
 #include <algorithm>
+#include <array>
 #include <tuple>
 #include <boost/tuple/tuple.hpp>
 #include <boost/circular_buffer.hpp>
@@ -283,6 +284,29 @@ struct prioritized_item_id
     }
 };
 
+const size_t delegate_call_histogram_size = 6;
+const std::array<int64_t, delegate_call_histogram_size> delegate_call_histogram_bounds_us
+    = { { 100, 1000, 10000, 100000, 500000, 1000000 } };
+
+// counts calls by the bounds of delegate_call_histogram_bounds_us, the last counter is for the longer calls
+struct call_latency_histogram
+{
+    call_latency_histogram()
+    {
+        counts.fill(0);
+    }
+
+    void add(int64_t duration_us)
+    {
+        const size_t bucket = std::lower_bound(delegate_call_histogram_bounds_us.begin(),
+                                               delegate_call_histogram_bounds_us.end(), duration_us)
+            - delegate_call_histogram_bounds_us.begin();
+        ++counts[bucket];
+    }
+
+    std::array<uint64_t, delegate_call_histogram_size + 1> counts;
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 class statistics_gathering_node_delegate_wrapper : public node_delegate
 {
@@ -319,7 +343,8 @@ private:
 #define DECLARE_ACCUMULATOR(r, data, method_name)                                                                      \
     mutable call_stats_accumulator BOOST_PP_CAT(_, BOOST_PP_CAT(method_name, _execution_accumulator));                 \
     mutable call_stats_accumulator BOOST_PP_CAT(_, BOOST_PP_CAT(method_name, _delay_before_accumulator));              \
-    mutable call_stats_accumulator BOOST_PP_CAT(_, BOOST_PP_CAT(method_name, _delay_after_accumulator));
+    mutable call_stats_accumulator BOOST_PP_CAT(_, BOOST_PP_CAT(method_name, _delay_after_accumulator));               \
+    mutable call_latency_histogram BOOST_PP_CAT(_, BOOST_PP_CAT(method_name, _execution_histogram));
     BOOST_PP_SEQ_FOR_EACH(DECLARE_ACCUMULATOR, unused, NODE_DELEGATE_METHOD_NAMES)
 #undef DECLARE_ACCUMULATOR
 
@@ -333,6 +358,7 @@ private:
         call_stats_accumulator* _execution_accumulator;
         call_stats_accumulator* _delay_before_accumulator;
         call_stats_accumulator* _delay_after_accumulator;
+        call_latency_histogram* _execution_histogram;
 
     public:
         class actual_execution_measurement_helper
@@ -353,12 +379,14 @@ private:
         call_statistics_collector(const char* method_name,
                                   call_stats_accumulator* execution_accumulator,
                                   call_stats_accumulator* delay_before_accumulator,
-                                  call_stats_accumulator* delay_after_accumulator)
+                                  call_stats_accumulator* delay_after_accumulator,
+                                  call_latency_histogram* execution_histogram)
             : _call_requested_time(fc::time_point::now())
             , _method_name(method_name)
             , _execution_accumulator(execution_accumulator)
             , _delay_before_accumulator(delay_before_accumulator)
             , _delay_after_accumulator(delay_after_accumulator)
+            , _execution_histogram(execution_histogram)
         {
         }
         ~call_statistics_collector()
@@ -371,6 +399,7 @@ private:
             (*_execution_accumulator)(actual_execution_time.count());
             (*_delay_before_accumulator)(delay_before.count());
             (*_delay_after_accumulator)(delay_after.count());
+            _execution_histogram->add(actual_execution_time.count());
             if (total_duration > fc::milliseconds(500))
             {
                 ilog("Call to method node_delegate::${method} took ${total_duration}us, longer than our target maximum "
@@ -398,6 +427,7 @@ public:
     statistics_gathering_node_delegate_wrapper(node_delegate* delegate, fc::thread* thread_for_delegate_calls);
 
     fc::variant_object get_call_statistics();
+    std::vector<delegate_call_statistics> get_delegate_call_statistics() const;
 
     bool has_item(const net::item_id& id) override;
     void handle_message(const message&) override;
@@ -806,6 +836,7 @@ public:
     void set_total_bandwidth_limit(uint32_t upload_bytes_per_second, uint32_t download_bytes_per_second);
     void disable_peer_advertising();
     fc::variant_object get_call_statistics() const;
+    node_statistics get_statistics() const;
     message get_message_for_item(const item_id& item) override;
 
     fc::variant_object network_get_info() const;
@@ -3824,6 +3855,7 @@ void node_impl::process_block_message(peer_connection* originating_peer,
         = originating_peer->items_requested_from_peer.find(item_id(graphene::net::block_message_type, message_hash));
     if (item_iter != originating_peer->items_requested_from_peer.end())
     {
+        originating_peer->item_received(item_iter->second);
         originating_peer->items_requested_from_peer.erase(item_iter);
         process_block_during_normal_operation(originating_peer, block_message_to_process, message_hash);
         if (originating_peer->idle())
@@ -4192,6 +4224,7 @@ void node_impl::process_ordinary_message(peer_connection* originating_peer,
     }
     else
     {
+        originating_peer->item_received(iter->second);
         originating_peer->items_requested_from_peer.erase(iter);
         if (originating_peer->idle())
             trigger_fetch_items_loop();
@@ -5425,6 +5458,74 @@ fc::variant_object node_impl::get_call_statistics() const
     return _delegate->get_call_statistics();
 }
 
+node_statistics node_impl::get_statistics() const
+{
+    VERIFY_CORRECT_THREAD();
+
+    node_statistics result;
+
+    // block numbers are resolved by the delegate after the loop
+    std::vector<item_hash_t> head_block_ids;
+    head_block_ids.reserve(_active_connections.size());
+
+    result.sync.is_syncing = false;
+    for (const peer_connection_ptr& peer : _active_connections)
+    {
+        ASSERT_TASK_NOT_PREEMPTED(); // don't yield while iterating over _active_connections
+
+        peer_statistics stats;
+        stats.host = peer->get_remote_endpoint();
+        stats.node_id = peer->node_id;
+        stats.user_agent = peer->user_agent;
+        stats.inbound = peer->direction == peer_connection_direction::inbound;
+        stats.connection_time = peer->get_connection_time();
+        stats.bytes_sent = peer->get_total_bytes_sent();
+        stats.bytes_received = peer->get_total_bytes_received();
+        stats.send_queue_messages = peer->get_queued_messages_count();
+        stats.send_queue_bytes = peer->get_total_queued_messages_size();
+        stats.round_trip_delay_us = peer->round_trip_delay.count();
+        stats.clock_offset_us = peer->clock_offset.count();
+        stats.items_received = peer->items_received_from_peer;
+        stats.item_fetch_latency_sum_us = peer->item_fetch_latency_sum.count();
+        stats.item_fetch_latency_max_us = peer->item_fetch_latency_max.count();
+        stats.items_requested = peer->items_requested_from_peer.size();
+        stats.sync_items_requested = peer->sync_items_requested_from_peer.size();
+        stats.sync_items_to_get = peer->ids_of_items_to_get.size();
+        stats.we_need_sync_items_from_peer = peer->we_need_sync_items_from_peer;
+        stats.peer_needs_sync_items_from_us = peer->peer_needs_sync_items_from_us;
+
+        head_block_ids.push_back(peer->last_block_delegate_has_seen);
+
+        result.sync.is_syncing = result.sync.is_syncing || peer->we_need_sync_items_from_peer;
+        result.peers.push_back(stats);
+    }
+
+    result.sync.unfetched_items = _total_number_of_unfetched_items;
+    result.sync.active_requests = _active_sync_requests.size();
+    result.sync.received_items = _received_sync_items.size();
+    result.sync.items_to_fetch = _items_to_fetch.size();
+
+    if (!_average_network_read_speed_seconds.empty())
+        result.download_bytes_per_second = boost::accumulate(_average_network_read_speed_seconds, uint64_t(0))
+            / _average_network_read_speed_seconds.size();
+    if (!_average_network_write_speed_seconds.empty())
+        result.upload_bytes_per_second = boost::accumulate(_average_network_write_speed_seconds, uint64_t(0))
+            / _average_network_write_speed_seconds.size();
+
+    result.delegate_call_histogram_bounds_us.assign(delegate_call_histogram_bounds_us.begin(),
+                                                    delegate_call_histogram_bounds_us.end());
+    // taken before the calls below, so the statistics don't count the calls made to collect them
+    result.delegate_calls = _delegate->get_delegate_call_statistics();
+
+    for (size_t i = 0; i < result.peers.size(); ++i)
+    {
+        if (head_block_ids[i] != item_hash_t())
+            result.peers[i].head_block_number = _delegate->get_block_number(head_block_ids[i]);
+    }
+
+    return result;
+}
+
 fc::variant_object node_impl::network_get_info() const
 {
     VERIFY_CORRECT_THREAD();
@@ -5629,6 +5730,11 @@ fc::variant_object node::get_call_statistics() const
     INVOKE_IN_IMPL(get_call_statistics);
 }
 
+node_statistics node::get_statistics() const
+{
+    INVOKE_IN_IMPL(get_statistics);
+}
+
 fc::variant_object node::network_get_info() const
 {
     INVOKE_IN_IMPL(network_get_info);
@@ -5776,6 +5882,42 @@ fc::variant_object statistics_gathering_node_delegate_wrapper::get_call_statisti
     return statistics;
 }
 
+template <typename Accumulator>
+delegate_call_statistics make_delegate_call_statistics(const char* method,
+                                                       const Accumulator& execution,
+                                                       const Accumulator& delay_before,
+                                                       const Accumulator& delay_after,
+                                                       const call_latency_histogram& histogram)
+{
+    delegate_call_statistics stats;
+    stats.method = method;
+    stats.calls = boost::accumulators::count(execution);
+    stats.execution_sum_us = boost::accumulators::sum(execution);
+    stats.execution_max_us = stats.calls ? boost::accumulators::max(execution) : 0;
+    stats.execution_histogram.assign(histogram.counts.begin(), histogram.counts.end());
+    stats.delay_before_sum_us = boost::accumulators::sum(delay_before);
+    stats.delay_after_sum_us = boost::accumulators::sum(delay_after);
+    return stats;
+}
+
+std::vector<delegate_call_statistics> statistics_gathering_node_delegate_wrapper::get_delegate_call_statistics() const
+{
+    std::vector<delegate_call_statistics> result;
+
+#define ADD_DELEGATE_CALL_STATISTICS(r, data, method_name)                                                             \
+    result.push_back(                                                                                                  \
+        make_delegate_call_statistics(BOOST_PP_STRINGIZE(method_name),                                                 \
+                                      BOOST_PP_CAT(_, BOOST_PP_CAT(method_name, _execution_accumulator)),              \
+                                      BOOST_PP_CAT(_, BOOST_PP_CAT(method_name, _delay_before_accumulator)),           \
+                                      BOOST_PP_CAT(_, BOOST_PP_CAT(method_name, _delay_after_accumulator)),            \
+                                      BOOST_PP_CAT(_, BOOST_PP_CAT(method_name, _execution_histogram))));
+
+    BOOST_PP_SEQ_FOR_EACH(ADD_DELEGATE_CALL_STATISTICS, unused, NODE_DELEGATE_METHOD_NAMES)
+#undef ADD_DELEGATE_CALL_STATISTICS
+
+    return result;
+}
+
 // define VERBOSE_NODE_DELEGATE_LOGGING to log whenever the node delegate throws exceptions
 //#define VERBOSE_NODE_DELEGATE_LOGGING
 #ifdef VERBOSE_NODE_DELEGATE_LOGGING
@@ -5784,7 +5926,8 @@ fc::variant_object statistics_gathering_node_delegate_wrapper::get_call_statisti
     {                                                                                                                  \
         call_statistics_collector statistics_collector(#method_name, &_##method_name##_execution_accumulator,          \
                                                        &_##method_name##_delay_before_accumulator,                     \
-                                                       &_##method_name##_delay_after_accumulator);                     \
+                                                       &_##method_name##_delay_after_accumulator,                      \
+                                                       &_##method_name##_execution_histogram);                         \
         if (_thread->is_current())                                                                                     \
         {                                                                                                              \
             call_statistics_collector::actual_execution_measurement_helper helper(statistics_collector);               \
@@ -5819,7 +5962,8 @@ fc::variant_object statistics_gathering_node_delegate_wrapper::get_call_statisti
 #define INVOKE_AND_COLLECT_STATISTICS(method_name, ...)                                                                \
     call_statistics_collector statistics_collector(#method_name, &_##method_name##_execution_accumulator,              \
                                                    &_##method_name##_delay_before_accumulator,                         \
-                                                   &_##method_name##_delay_after_accumulator);                         \
+                                                   &_##method_name##_delay_after_accumulator,                          \
+                                                   &_##method_name##_execution_histogram);                             \
     if (_thread->is_current())                                                                                         \
     {                                                                                                                  \
         call_statistics_collector::actual_execution_measurement_helper helper(statistics_collector);                   \
@@ -28,6 +28,8 @@
 
 #include <fc/thread/thread.hpp>
 
+#include <algorithm>
+
 #include <boost/scope_exit.hpp>
 
 #ifdef DEFAULT_LOGGER
@@ -88,6 +90,7 @@ peer_connection::peer_connection(peer_connection_delegate* delegate)
     , peer_needs_sync_items_from_us(true)
     , we_need_sync_items_from_peer(true)
     , inhibit_fetching_sync_blocks(false)
+    , items_received_from_peer(0)
     , transaction_fetching_inhibited_until(fc::time_point::min())
     , last_known_fork_block_number(0)
     , firewall_check_state(nullptr)
@@ -444,6 +447,28 @@ uint64_t peer_connection::get_total_bytes_received() const
     return _message_connection.get_total_bytes_received();
 }
 
+size_t peer_connection::get_queued_messages_count() const
+{
+    VERIFY_CORRECT_THREAD();
+    return _queued_messages.size();
+}
+
+size_t peer_connection::get_total_queued_messages_size() const
+{
+    VERIFY_CORRECT_THREAD();
+    return _total_queued_messages_size;
+}
+
+void peer_connection::item_received(const fc::time_point& request_time)
+{
+    VERIFY_CORRECT_THREAD();
+    const fc::microseconds latency = fc::time_point::now() - request_time;
+
+    ++items_received_from_peer;
+    item_fetch_latency_sum += latency;
+    item_fetch_latency_max = std::max(item_fetch_latency_max, latency);
+}
+
 fc::time_point peer_connection::get_last_message_sent_time() const
 {
     VERIFY_CORRECT_THREAD();
@@ -21,6 +21,8 @@ public:
     void get_block_info(const get_block_info_args& args, std::vector<block_info>& result);
     void get_blocks_with_info(const get_block_info_args& args, std::vector<block_with_info>& result);
 
+    uint32_t get_end_block_num(const get_block_info_args& args);
+
     scorum::app::application& app;
 };
 
@@ -34,38 +36,56 @@ std::shared_ptr<scorum::plugin::block_info::block_info_plugin> block_info_api_im
     return app.get_plugin<block_info_plugin>("block_info");
 }
 
-void block_info_api_impl::get_block_info(const get_block_info_args& args, std::vector<block_info>& result)
+uint32_t block_info_api_impl::get_end_block_num(const get_block_info_args& args)
 {
-    const std::vector<block_info>& _block_info = get_plugin()->_block_info;
+    const block_info_store& store = get_plugin()->_block_info_store;
+    const chain::database& db = get_plugin()->database();
 
     FC_ASSERT(args.start_block_num > 0);
     FC_ASSERT(args.count <= 10000);
-    uint32_t n = std::min(uint32_t(_block_info.size()), args.start_block_num + args.count);
-    for (uint32_t block_num = args.start_block_num; block_num < n; block_num++)
-        result.emplace_back(_block_info[block_num]);
-    return;
+
+    // records above the head are left by popped blocks
+    return std::min(std::min(store.size(), db.head_block_num() + 1), args.start_block_num + args.count);
 }
 
-void block_info_api_impl::get_blocks_with_info(const get_block_info_args& args, std::vector<block_with_info>& result)
+void block_info_api_impl::get_block_info(const get_block_info_args& args, std::vector<block_info>& result)
 {
-    const std::vector<block_info>& _block_info = get_plugin()->_block_info;
-    const chain::database& db = get_plugin()->database();
+    const block_info_store& store = get_plugin()->_block_info_store;
+    chain::database& db = get_plugin()->database();
+
+    db.with_read_lock([&]() {
+        uint32_t n = get_end_block_num(args);
+        for (uint32_t block_num = args.start_block_num; block_num < n; block_num++)
+            result.emplace_back(store.get(block_num));
+    });
+}
 
-    FC_ASSERT(args.start_block_num > 0);
-    FC_ASSERT(args.count <= 10000);
-    uint32_t n = std::min(uint32_t(_block_info.size()), args.start_block_num + args.count);
-    uint64_t total_size = 0;
-    for (uint32_t block_num = args.start_block_num; block_num < n; block_num++)
-    {
-        uint64_t new_size = total_size + _block_info[block_num].block_size;
-        if ((new_size > 8 * 1024 * 1024) && (block_num != args.start_block_num))
-            break;
-        total_size = new_size;
-        result.emplace_back();
-        result.back().block = *db.fetch_block_by_number(block_num);
-        result.back().info = _block_info[block_num];
-    }
-    return;
+void block_info_api_impl::get_blocks_with_info(const get_block_info_args& args, std::vector<block_with_info>& result)
+{
+    const block_info_store& store = get_plugin()->_block_info_store;
+    chain::database& db = get_plugin()->database();
+
+    db.with_read_lock([&]() {
+        uint32_t n = get_end_block_num(args);
+        uint64_t total_size = 0;
+        for (uint32_t block_num = args.start_block_num; block_num < n; block_num++)
+        {
+            block_info info = store.get(block_num);
+            uint64_t new_size = total_size + info.block_size;
+            if ((new_size > 8 * 1024 * 1024) && (block_num != args.start_block_num))
+                break;
+            total_size = new_size;
+            result.emplace_back();
+            result.back().info = info;
+        }
+
+        // all blocks are read at once, so the block log is read sequentially
+        auto blocks = db.fetch_block_range(args.start_block_num, (uint32_t)result.size());
+        FC_ASSERT(blocks.size() == result.size(), "Some of requested blocks are not found");
+
+        for (size_t i = 0; i < blocks.size(); ++i)
+            result[i].block = std::move(blocks[i]);
+    });
 }
 
 } // detail
@@ -30,6 +30,10 @@ void block_info_plugin::plugin_initialize(const boost::program_options::variable
 {
     chain::database& db = database();
 
+    // stored next to the block log as it describes the blocks of the log
+    fc::path data_dir = options.at("data-dir").as<boost::filesystem::path>();
+    _block_info_store.open(data_dir / "blockchain" / "block_info.bin");
+
     _applied_block_conn = db.applied_block.connect([this](const chain::signed_block& b) { on_applied_block(b); });
 }
 
@@ -40,24 +44,21 @@ void block_info_plugin::plugin_startup()
 
 void block_info_plugin::plugin_shutdown()
 {
+    _block_info_store.close();
 }
 
 void block_info_plugin::on_applied_block(const chain::signed_block& b)
 {
-    uint32_t block_num = b.block_num();
     const chain::database& db = database();
-
-    while (block_num >= _block_info.size())
-        _block_info.emplace_back();
-
-    block_info& info = _block_info[block_num];
     const chain::dynamic_global_property_object& dgpo = db.obtain_service<chain::dbs_dynamic_global_property>().get();
 
+    block_info info;
     info.block_id = b.id();
     info.block_size = fc::raw::pack_size(b);
     info.aslot = dgpo.current_aslot;
     info.last_irreversible_block_num = dgpo.last_irreversible_block_num;
-    return;
+
+    _block_info_store.set(b.block_num(), info);
 }
 }
 }
@@ -0,0 +1,169 @@
+#include <scorum/plugins/block_info/block_info_store.hpp>
+
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <cstring>
+#include <fstream>
+
+namespace scorum {
+namespace plugin {
+namespace block_info {
+
+namespace {
+const uint64_t store_magic = 0x4f464e494b4c4253ull; // "SBLKINFO"
+const uint32_t store_version = 1;
+
+// ~40MB per chunk, about a year of blocks
+const uint32_t records_per_chunk = 1024 * 1024;
+}
+
+struct block_info_store::header_type
+{
+    uint64_t magic;
+    uint32_t version;
+    uint32_t record_size;
+    uint32_t size;
+    uint32_t capacity;
+};
+
+struct block_info_store::record_type
+{
+    char block_id[20];
+    uint32_t block_size;
+    uint64_t aslot;
+    uint32_t last_irreversible_block_num;
+    uint32_t reserved;
+};
+
+block_info_store::block_info_store()
+{
+}
+
+block_info_store::~block_info_store()
+{
+    close();
+}
+
+void block_info_store::open(const fc::path& file)
+{
+    close();
+
+    _file = file;
+
+    if (!boost::filesystem::exists(_file))
+    {
+        boost::filesystem::create_directories(_file.parent_path());
+
+        header_type h;
+        h.magic = store_magic;
+        h.version = store_version;
+        h.record_size = sizeof(record_type);
+        h.size = 0;
+        h.capacity = 0;
+
+        std::ofstream out(_file.generic_string().c_str(), std::ios::binary | std::ios::trunc);
+        out.write((const char*)&h, sizeof(h));
+        FC_ASSERT(out.good(), "Could not create ${f}", ("f", _file));
+    }
+
+    map();
+
+    const header_type& h = header();
+    FC_ASSERT(h.magic == store_magic && h.version == store_version && h.record_size == sizeof(record_type),
+              "${f} is not a block info store of this version", ("f", _file));
+}
+
+void block_info_store::close()
+{
+    if (_region)
+    {
+        flush();
+        _region.reset();
+    }
+}
+
+bool block_info_store::is_open() const
+{
+    return (bool)_region;
+}
+
+void block_info_store::flush()
+{
+    FC_ASSERT(is_open());
+    _region->flush();
+}
+
+void block_info_store::set(uint32_t block_num, const block_info& info)
+{
+    FC_ASSERT(is_open());
+
+    if (block_num >= header().capacity)
+        reserve(block_num + 1);
+
+    record_type& r = records()[block_num];
+
+    memcpy(r.block_id, info.block_id.data(), sizeof(r.block_id));
+    r.block_size = info.block_size;
+    r.aslot = info.aslot;
+    r.last_irreversible_block_num = info.last_irreversible_block_num;
+
+    if (block_num >= header().size)
+        header().size = block_num + 1;
+}
+
+block_info block_info_store::get(uint32_t block_num) const
+{
+    FC_ASSERT(is_open());
+    FC_ASSERT(block_num < size(), "Block info of ${n} is not stored", ("n", block_num));
+
+    const record_type& r = records()[block_num];
+
+    block_info info;
+    memcpy(info.block_id.data(), r.block_id, sizeof(r.block_id));
+    info.block_size = r.block_size;
+    info.aslot = r.aslot;
+    info.last_irreversible_block_num = r.last_irreversible_block_num;
+
+    return info;
+}
+
+uint32_t block_info_store::size() const
+{
+    return is_open() ? header().size : 0;
+}
+
+void block_info_store::map()
+{
+    boost::interprocess::file_mapping mapping(_file.generic_string().c_str(), boost::interprocess::read_write);
+    _region.reset(new boost::interprocess::mapped_region(mapping, boost::interprocess::read_write));
+}
+
+void block_info_store::reserve(uint32_t records_count)
+{
+    const uint32_t capacity = (records_count / records_per_chunk + 1) * records_per_chunk;
+
+    _region->flush();
+    _region.reset();
+
+    // new records are filled with zeros, that's the empty record
+    boost::filesystem::resize_file(_file, sizeof(header_type) + uint64_t(capacity) * sizeof(record_type));
+
+    map();
+
+    header().capacity = capacity;
+}
+
+block_info_store::header_type& block_info_store::header() const
+{
+    return *static_cast<header_type*>(_region->get_address());
+}
+
+block_info_store::record_type* block_info_store::records() const
+{
+    return reinterpret_cast<record_type*>(static_cast<char*>(_region->get_address()) + sizeof(header_type));
+}
+}
+}
+}
@@ -3,9 +3,9 @@
 
 #include <scorum/app/plugin.hpp>
 #include <scorum/plugins/block_info/block_info.hpp>
+#include <scorum/plugins/block_info/block_info_store.hpp>
 
 #include <string>
-#include <vector>
 
 namespace scorum {
 namespace protocol {
@@ -32,7 +32,7 @@ public:
 
     void on_applied_block(const chain::signed_block& b);
 
-    std::vector<block_info> _block_info;
+    block_info_store _block_info_store;
 
     boost::signals2::scoped_connection _applied_block_conn;
 };
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <memory>
+
+#include <fc/filesystem.hpp>
+
+#include <scorum/plugins/block_info/block_info.hpp>
+
+namespace boost {
+namespace interprocess {
+class mapped_region;
+}
+}
+
+namespace scorum {
+namespace plugin {
+namespace block_info {
+
+/**
+ * Memory mapped file of block_info records of fixed size. The record of block N is stored at position N,
+ * so it is written and read without any lookup. The file grows by chunks and is kept between restarts.
+ *
+ * Records of the blocks which were not applied while the plugin was enabled are empty.
+ */
+class block_info_store
+{
+public:
+    block_info_store();
+    ~block_info_store();
+
+    void open(const fc::path& file);
+    void close();
+    bool is_open() const;
+
+    void flush();
+
+    void set(uint32_t block_num, const block_info& info);
+
+    block_info get(uint32_t block_num) const;
+
+    /**
+     * Number of records including the empty record of block 0
+     */
+    uint32_t size() const;
+
+private:
+    struct header_type;
+    struct record_type;
+
+    void map();
+    void reserve(uint32_t records_count);
+
+    header_type& header() const;
+    record_type* records() const;
+
+    fc::path _file;
+    std::unique_ptr<boost::interprocess::mapped_region> _region;
+};
+}
+}
+}
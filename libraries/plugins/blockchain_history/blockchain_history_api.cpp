@@ -60,7 +60,7 @@ public:
     {
     }
 
-    using result_type = std::map<uint32_t, applied_operation>;
+    using result_type = applied_operation_map_type;
 
     template <typename IndexType> result_type get_ops_history(uint32_t from_op, uint32_t limit) const
     {
@@ -84,11 +84,13 @@ public:
         auto end = itr->id._id;
         auto range = idx.range(start < boost::lambda::_1, boost::lambda::_1 <= end);
 
+        result.reserve(limit);
+
         for (auto it = range.first; it != range.second; ++it)
         {
             auto id = it->id;
             FC_ASSERT(id._id >= 0, "Invalid operation_object id");
-            result[(uint32_t)id._id] = get_operation(*it);
+            result.emplace_hint(result.end(), (uint32_t)id._id, get_operation(*it));
         }
 
         return result;
@@ -102,6 +104,9 @@ public:
 
         auto range = idx.equal_range(block_num);
 
+        result.reserve(std::distance(range.first, range.second));
+
+        // by_location is ordered by id inside of the block
         for (auto it = range.first; it != range.second; ++it)
         {
             auto id = it->id;
@@ -109,7 +114,7 @@ public:
             if (operation_filter(temp.op))
             {
                 FC_ASSERT(id._id >= 0, "Invalid operation_object id");
-                result[(uint32_t)id._id] = temp;
+                result.emplace_hint(result.end(), (uint32_t)id._id, std::move(temp));
             }
         }
 
@@ -123,14 +128,13 @@ public:
 #ifdef SKIP_BY_TX_ID
         FC_ASSERT(false, "This node's operator has disabled operation indexing by transaction_id");
 #else
-        FC_ASSERT(!_app.is_read_only(), "get_transaction is not available in read-only mode.");
-
         const auto& idx = _db->get_index<operation_index>().indices().get<by_transaction_id>();
         auto itr = idx.lower_bound(id);
         if (itr != idx.end() && itr->trx_id == id)
         {
             auto blk = _db->fetch_block_by_number(itr->block);
-            FC_ASSERT(blk.valid());
+            // read only process has no fork database, it sees irreversible blocks only
+            FC_ASSERT(blk.valid(), "Block ${b} is not available yet.", ("b", itr->block));
             FC_ASSERT(blk->transactions.size() > itr->trx_in_block);
             annotated_signed_transaction result = blk->transactions[itr->trx_in_block];
             result.block_num = itr->block;
@@ -194,8 +198,9 @@ void blockchain_history_api::on_api_startup()
 {
 }
 
-std::map<uint32_t, applied_operation> blockchain_history_api::get_ops_history(
-    uint32_t from_op, uint32_t limit, applied_operation_type type_of_operation) const
+applied_operation_map_type blockchain_history_api::get_ops_history(uint32_t from_op,
+                                                                   uint32_t limit,
+                                                                   applied_operation_type type_of_operation) const
 {
     return _impl->_app.chain_database()->with_read_lock([&]() {
         switch (type_of_operation)
@@ -213,8 +218,8 @@ std::map<uint32_t, applied_operation> blockchain_history_api::get_ops_history(
     });
 }
 
-std::map<uint32_t, applied_operation>
-blockchain_history_api::get_ops_in_block(uint32_t block_num, applied_operation_type type_of_operation) const
+applied_operation_map_type blockchain_history_api::get_ops_in_block(uint32_t block_num,
+                                                                    applied_operation_type type_of_operation) const
 {
     return _impl->_app.chain_database()->with_read_lock([&]() {
         switch (type_of_operation)
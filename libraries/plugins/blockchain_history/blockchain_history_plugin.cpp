@@ -9,6 +9,8 @@
 
 #include <scorum/chain/database/database.hpp>
 #include <scorum/chain/operation_notification.hpp>
+#include <scorum/chain/services/dynamic_global_property.hpp>
+#include <scorum/chain/schema/dynamic_global_property_object.hpp>
 #include <scorum/blockchain_history/schema/operation_objects.hpp>
 
 #include <fc/smart_ref_impl.hpp>
@@ -54,17 +56,27 @@ public:
         db.add_plugin_index<filtered_market_operations_history_index>();
 
         db.pre_apply_operation.connect([&](const operation_notification& note) { on_operation(note); });
+
+        if (_retention_days)
+            db.applied_block.connect([&](const signed_block&) { prune_expired_history(); });
     }
 
     const operation_object& create_operation_obj(const operation_notification& note);
     void update_filtered_operation_index(const operation_object& object, const operation& op);
     void on_operation(const operation_notification& note);
 
+    void prune_expired_history();
+    template <typename Index> void prune_history_of_operations(operation_object::id_type prune_before);
+
     blockchain_history_plugin& _self;
     flat_map<account_name_type, account_name_type> _tracked_accounts;
     bool _filter_content = false;
     bool _blacklist = false;
     flat_set<std::string> _op_list;
+
+    uint32_t _retention_days = 0;
+    uint32_t _retention_ops_per_account = 0;
+    uint32_t _pruning_batch_size = 1000;
 };
 
 class operation_visitor
@@ -72,14 +84,22 @@ class operation_visitor
     database& _db;
     const operation_object& _obj;
     account_name_type _item;
+    uint32_t _retention_ops;
+    uint32_t _pruning_batch_size;
 
 public:
     using result_type = void;
 
-    operation_visitor(database& db, const operation_object& obj, const account_name_type& i)
+    operation_visitor(database& db,
+                      const operation_object& obj,
+                      const account_name_type& i,
+                      uint32_t retention_ops,
+                      uint32_t pruning_batch_size)
         : _db(db)
         , _obj(obj)
         , _item(i)
+        , _retention_ops(retention_ops)
+        , _pruning_batch_size(pruning_batch_size)
     {
     }
 
@@ -114,6 +134,24 @@ private:
             ahist.sequence = sequence;
             ahist.op = op.id;
         });
+
+        if (_retention_ops && sequence >= _retention_ops)
+        {
+            const uint32_t last_irreversible_block_num
+                = _db.obtain_service<chain::dbs_dynamic_global_property>().get().last_irreversible_block_num;
+
+            // the history of the account is ordered by sequence descending, the entries to remove follow the kept ones.
+            // Entries of reversible operations are kept, they are removed with the next operations of the account.
+            auto itr = hist_idx.lower_bound(boost::make_tuple(_item, sequence - _retention_ops));
+            for (uint32_t count = 0; count < _pruning_batch_size && itr != hist_idx.end() && itr->account == _item;
+                 ++count)
+            {
+                const auto& hist = *itr;
+                ++itr;
+                if (_db.get(hist.op).block <= last_irreversible_block_num)
+                    _db.remove(hist);
+            }
+        }
     }
 };
 
@@ -230,11 +268,57 @@ void blockchain_history_plugin_impl::on_operation(const operation_notification&
 
         if (!_tracked_accounts.size() || (itr != _tracked_accounts.end() && itr->first <= item && item <= itr->second))
         {
-            note.op.visit(operation_visitor(db, new_obj, item));
+            note.op.visit(operation_visitor(db, new_obj, item, _retention_ops_per_account, _pruning_batch_size));
         }
     }
 }
 
+void blockchain_history_plugin_impl::prune_expired_history()
+{
+    scorum::chain::database& db = database();
+
+    const auto& dgp = db.obtain_service<chain::dbs_dynamic_global_property>().get();
+    const fc::time_point_sec prune_time = db.head_block_time() - fc::days(_retention_days);
+
+    // operations are created in order of time, so the expired ones are at the beginning of the index
+    const auto& op_idx = db.get_index<operation_index>().indices().get<by_id>();
+
+    auto itr = op_idx.begin();
+    for (uint32_t count = 0; count < _pruning_batch_size && itr != op_idx.end(); ++count, ++itr)
+    {
+        if (itr->timestamp >= prune_time || itr->block > dgp.last_irreversible_block_num)
+            break;
+    }
+
+    if (itr == op_idx.begin())
+        return;
+
+    const operation_object::id_type prune_before
+        = itr != op_idx.end() ? itr->id : operation_object::id_type(std::prev(itr)->id._id + 1);
+
+    // history objects are removed first, so that they never refer to the removed operations
+    prune_history_of_operations<account_operations_full_history_index>(prune_before);
+    prune_history_of_operations<transfers_to_scr_history_index>(prune_before);
+    prune_history_of_operations<transfers_to_sp_history_index>(prune_before);
+    prune_history_of_operations<filtered_not_virt_operations_history_index>(prune_before);
+    prune_history_of_operations<filtered_virt_operations_history_index>(prune_before);
+    prune_history_of_operations<filtered_market_operations_history_index>(prune_before);
+
+    while (!op_idx.empty() && op_idx.begin()->id < prune_before)
+        db.remove(*op_idx.begin());
+}
+
+template <typename Index>
+void blockchain_history_plugin_impl::prune_history_of_operations(operation_object::id_type prune_before)
+{
+    scorum::chain::database& db = database();
+
+    // history objects are created in order of their operations
+    const auto& idx = db.get_index<Index>().indices().template get<by_id>();
+    while (!idx.empty() && idx.begin()->op < prune_before)
+        db.remove(*idx.begin());
+}
+
 } // end namespace detail
 
 blockchain_history_plugin::blockchain_history_plugin(application* app)
@@ -263,6 +347,17 @@ void blockchain_history_plugin::plugin_set_program_options(boost::program_option
                  "Defines a list of operations which will be explicitly logged.")(
         "history-blacklist-ops", boost::program_options::value<std::vector<std::string>>()->composing(),
         "Defines a list of operations which will be explicitly ignored.");
+    // clang-format off
+    cli.add_options()
+        ("history-retention-days", boost::program_options::value<uint32_t>()->default_value(0),
+         "Removes operations older than the given number of days from the history, 0 keeps all of them.")
+        ("history-retention-ops-per-account", boost::program_options::value<uint32_t>()->default_value(0),
+         "Keeps only the given number of the last operations in the history of each account, 0 keeps all of them. "
+         "It limits the account history only: the operations stay in the blockchain history until they are removed "
+         "by history-retention-days, so this option alone does not shrink the state.")
+        ("history-pruning-batch-size", boost::program_options::value<uint32_t>()->default_value(1000),
+         "Maximum number of expired operations removed from the history per block.");
+    // clang-format on
     cfg.add(cli);
 }
 
@@ -312,6 +407,15 @@ void blockchain_history_plugin::plugin_initialize(const boost::program_options::
             ilog("Account History: blacklisting ops ${o}", ("o", _my->_op_list));
         }
 
+        if (options.count("history-retention-days"))
+            _my->_retention_days = options.at("history-retention-days").as<uint32_t>();
+        if (options.count("history-retention-ops-per-account"))
+            _my->_retention_ops_per_account = options.at("history-retention-ops-per-account").as<uint32_t>();
+        if (options.count("history-pruning-batch-size"))
+            _my->_pruning_batch_size = options.at("history-pruning-batch-size").as<uint32_t>();
+
+        FC_ASSERT(_my->_pruning_batch_size > 0, "history-pruning-batch-size must be greater than zero");
+
         _my->initialize();
     }
     FC_LOG_AND_RETHROW()
@@ -323,6 +427,21 @@ void blockchain_history_plugin::plugin_startup()
 {
     app().register_api_factory<account_history_api>(API_ACCOUNT_HISTORY);
     app().register_api_factory<blockchain_history_api>(API_BLOCKCHAIN_HISTORY);
+
+    app().register_binary_api(API_BLOCKCHAIN_HISTORY, [](const fc::api_ptr& ptr) {
+        auto api = ptr->as<blockchain_history_api>();
+
+        using scorum::app::make_binary_method;
+
+        scorum::app::binary_api_methods methods;
+        methods["get_ops_history"] = make_binary_method(api->get_ops_history);
+        methods["get_ops_in_block"] = make_binary_method(api->get_ops_in_block);
+        methods["get_block_header"] = make_binary_method(api->get_block_header);
+        methods["get_block_headers_history"] = make_binary_method(api->get_block_headers_history);
+        methods["get_block"] = make_binary_method(api->get_block);
+        methods["get_blocks_history"] = make_binary_method(api->get_blocks_history);
+        return methods;
+    });
 }
 
 flat_map<account_name_type, account_name_type> blockchain_history_plugin::tracked_accounts() const
@@ -40,7 +40,7 @@ public:
     *  @param limit - the maximum number of items that can be queried (0 to 100], must be less than from
     *  @param type_of_operation Operations type (all = 0, not_virt = 1, virt = 2, market = 3)
     */
-    std::map<uint32_t, applied_operation>
+    applied_operation_map_type
     get_ops_history(uint32_t from_op, uint32_t limit, applied_operation_type type_of_operation) const;
 
     /** Returns sequence of operations included/generated in a specified block
@@ -48,8 +48,7 @@ public:
     * @param block_num Block height of specified block
     * @param type_of_operation Operations type (all = 0, not_virt = 1, virt = 2, market = 3)
     */
-    std::map<uint32_t, applied_operation> get_ops_in_block(uint32_t block_num,
-                                                           applied_operation_type type_of_operation) const;
+    applied_operation_map_type get_ops_in_block(uint32_t block_num, applied_operation_type type_of_operation) const;
 
     /////////////////////////////
     // Blocks and transactions //
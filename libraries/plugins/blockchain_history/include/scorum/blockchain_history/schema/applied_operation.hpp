@@ -3,6 +3,8 @@
 #include <scorum/protocol/operations.hpp>
 #include "operation_objects.hpp"
 
+#include <fc/container/flat.hpp>
+
 namespace scorum {
 namespace blockchain_history {
 
@@ -22,6 +24,10 @@ struct applied_operation
     operation op;
 };
 
+// operations are always collected in ascending id order, so sorted vector is filled by appending
+// without per node allocations of std::map, and it is serialized to the same JSON
+using applied_operation_map_type = fc::flat_map<uint32_t, applied_operation>;
+
 enum class applied_operation_type
 {
     all = 0,
@@ -106,6 +106,7 @@ using filtered_market_operations_history_index = filtered_operation_index<filter
 FC_REFLECT(scorum::blockchain_history::operation_object,
            (id)(trx_id)(block)(trx_in_block)(op_in_trx)(timestamp)(serialized_op))
 CHAINBASE_SET_INDEX_TYPE(scorum::blockchain_history::operation_object, scorum::blockchain_history::operation_index)
+CHAINBASE_SET_DENSE_ID_INDEX(scorum::blockchain_history::operation_object)
 
 FC_REFLECT(scorum::blockchain_history::filtered_not_virt_operations_history_object, (id)(op))
 CHAINBASE_SET_INDEX_TYPE(scorum::blockchain_history::filtered_not_virt_operations_history_object,
@@ -0,0 +1,206 @@
+#include <scorum/plugins/cdc/cdc_plugin.hpp>
+
+#include <scorum/chain/database/database.hpp>
+#include <scorum/chain/services/dynamic_global_property.hpp>
+
+#include <scorum/chain/schema/account_objects.hpp>
+#include <scorum/chain/schema/atomicswap_objects.hpp>
+#include <scorum/chain/schema/budget_object.hpp>
+#include <scorum/chain/schema/chain_property_object.hpp>
+#include <scorum/chain/schema/comment_objects.hpp>
+#include <scorum/chain/schema/dev_committee_object.hpp>
+#include <scorum/chain/schema/dynamic_global_property_object.hpp>
+#include <scorum/chain/schema/proposal_object.hpp>
+#include <scorum/chain/schema/registration_objects.hpp>
+#include <scorum/chain/schema/reward_balancer_object.hpp>
+#include <scorum/chain/schema/reward_objects.hpp>
+#include <scorum/chain/schema/scorum_objects.hpp>
+#include <scorum/chain/schema/withdraw_scorumpower_objects.hpp>
+#include <scorum/chain/schema/witness_objects.hpp>
+
+#include <fc/io/raw.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <string>
+
+namespace scorum {
+namespace plugin {
+namespace cdc {
+
+namespace {
+
+// transactions and block summaries are bookkeeping of the node and are not streamed
+template <typename Visitor> void for_each_streamed_index(Visitor& visitor)
+{
+    using namespace scorum::chain;
+
+    visitor.template visit<account_index>();
+    visitor.template visit<account_authority_index>();
+    visitor.template visit<account_blogging_statistic_index>();
+    visitor.template visit<account_recovery_request_index>();
+    visitor.template visit<atomicswap_contract_index>();
+    visitor.template visit<budget_index>();
+    visitor.template visit<chain_property_index>();
+    visitor.template visit<change_recovery_account_request_index>();
+    visitor.template visit<comment_index>();
+    visitor.template visit<comment_content_index>();
+    visitor.template visit<comment_statistic_scr_index>();
+    visitor.template visit<comment_statistic_sp_index>();
+    visitor.template visit<comment_vote_index>();
+    visitor.template visit<decline_voting_rights_request_index>();
+    visitor.template visit<dev_committee_index>();
+    visitor.template visit<dynamic_global_property_index>();
+    visitor.template visit<escrow_index>();
+    visitor.template visit<fifa_world_cup_2018_bounty_reward_fund_index>();
+    visitor.template visit<owner_authority_history_index>();
+    visitor.template visit<proposal_object_index>();
+    visitor.template visit<registration_committee_member_index>();
+    visitor.template visit<registration_pool_index>();
+    visitor.template visit<reward_fund_scr_index>();
+    visitor.template visit<reward_fund_sp_index>();
+    visitor.template visit<reward_pool_index>();
+    visitor.template visit<scorumpower_delegation_expiration_index>();
+    visitor.template visit<scorumpower_delegation_index>();
+    visitor.template visit<withdraw_scorumpower_index>();
+    visitor.template visit<withdraw_scorumpower_route_index>();
+    visitor.template visit<withdraw_scorumpower_route_statistic_index>();
+    visitor.template visit<witness_index>();
+    visitor.template visit<witness_schedule_index>();
+    visitor.template visit<witness_vote_index>();
+}
+
+class collect_changes_visitor
+{
+public:
+    collect_changes_visitor(const chain::database& db, std::vector<object_change>& changes)
+        : _db(db)
+        , _changes(changes)
+    {
+    }
+
+    template <typename Index> void visit()
+    {
+        using value_type = typename Index::value_type;
+
+        _db.get_index<Index>().for_each_undo_change([&](const value_type* old_value, const value_type* new_value) {
+            object_change change;
+            change.type = !old_value ? object_change_type::created
+                                     : (!new_value ? object_change_type::removed : object_change_type::modified);
+            change.object_type = value_type::type_id;
+
+            const value_type& value = new_value ? *new_value : *old_value;
+            change.object_id = value.id._id;
+            change.value = fc::raw::pack(value);
+
+            _changes.push_back(std::move(change));
+        });
+    }
+
+private:
+    const chain::database& _db;
+    std::vector<object_change>& _changes;
+};
+}
+
+cdc_plugin::cdc_plugin(application* app)
+    : plugin(app)
+{
+}
+
+cdc_plugin::~cdc_plugin()
+{
+}
+
+std::string cdc_plugin::plugin_name() const
+{
+    return "cdc";
+}
+
+void cdc_plugin::plugin_set_program_options(boost::program_options::options_description& cli,
+                                            boost::program_options::options_description& cfg)
+{
+    // clang-format off
+    cli.add_options()
+        ("cdc-file", boost::program_options::value<boost::filesystem::path>()->default_value("cdc/state_changes.bin"),
+         "File to append the stream of state changes to. Relative path is relative to data-dir.");
+    // clang-format on
+    cfg.add(cli);
+}
+
+void cdc_plugin::plugin_initialize(const boost::program_options::variables_map& options)
+{
+    chain::database& db = database();
+
+    fc::path file = options.at("cdc-file").as<boost::filesystem::path>();
+    if (file.is_relative())
+        file = fc::path(options.at("data-dir").as<boost::filesystem::path>()) / file;
+
+    _stream.open(file);
+
+    _applied_block_conn = db.applied_block.connect([this](const chain::signed_block& b) { on_applied_block(b); });
+    _popped_block_conn = db.popped_block.connect([this](const chain::signed_block& b) { on_popped_block(b); });
+}
+
+void cdc_plugin::plugin_startup()
+{
+}
+
+void cdc_plugin::plugin_shutdown()
+{
+    _stream.close();
+}
+
+void cdc_plugin::on_applied_block(const chain::signed_block& b)
+{
+    const chain::database& db = database();
+    const uint32_t block_num = b.block_num();
+
+    // the block session is the head of the undo buffer until the block is pushed, there is no undo history on replay
+    if (db.get_index<chain::dynamic_global_property_index>().has_undo_state(block_num))
+    {
+        applied_block_record record;
+        record.block_num = block_num;
+        record.block_id = b.id();
+        record.timestamp = b.timestamp;
+
+        collect_changes_visitor visitor(db, record.changes);
+        for_each_streamed_index(visitor);
+
+        _stream.write(record);
+    }
+    else if (!_is_replay_reported)
+    {
+        wlog("State changes are not streamed for blocks applied without undo history (replay), first block: ${n}",
+             ("n", block_num));
+        _is_replay_reported = true;
+    }
+
+    const auto& dgp = db.obtain_service<chain::dbs_dynamic_global_property>().get();
+    if (dgp.last_irreversible_block_num > _last_irreversible_block_num)
+    {
+        _last_irreversible_block_num = dgp.last_irreversible_block_num;
+
+        irreversible_block_record record;
+        record.block_num = _last_irreversible_block_num;
+
+        _stream.write(record);
+    }
+
+    _stream.flush();
+}
+
+void cdc_plugin::on_popped_block(const chain::signed_block& b)
+{
+    popped_block_record record;
+    record.block_num = b.block_num();
+    record.block_id = b.id();
+
+    _stream.write(record);
+    _stream.flush();
+}
+}
+}
+} // scorum::plugin::cdc
+
+SCORUM_DEFINE_PLUGIN(cdc, scorum::plugin::cdc::cdc_plugin)
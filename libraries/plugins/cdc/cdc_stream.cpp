@@ -0,0 +1,181 @@
+#include <scorum/plugins/cdc/cdc_stream.hpp>
+
+#include <fc/exception/exception.hpp>
+#include <fc/io/raw.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+namespace scorum {
+namespace plugin {
+namespace cdc {
+
+namespace {
+const char stream_magic[] = { 'S', 'C', 'R', 'C', 'D', 'C', '0', '1' };
+
+void check_magic(std::istream& in, uint64_t file_size, const fc::path& file)
+{
+    // the file may end inside the magic if the node crashed right after creating it
+    const size_t size = std::min<uint64_t>(file_size, sizeof(stream_magic));
+
+    char magic[sizeof(stream_magic)] = {};
+    in.read(magic, size);
+
+    FC_ASSERT(in && std::memcmp(magic, stream_magic, size) == 0, "${f} is not a cdc stream of this version",
+              ("f", file));
+}
+
+// returns the size of the stream up to the end of its last complete frame, payloads are skipped without visitor
+uint64_t for_each_frame(std::istream& in, uint64_t file_size, std::function<void(const std::vector<char>&)> visit)
+{
+    uint64_t pos = sizeof(stream_magic);
+    in.seekg(pos);
+
+    while (file_size - pos >= sizeof(uint32_t))
+    {
+        uint32_t size = 0;
+        in.read((char*)&size, sizeof(size));
+
+        if (!in || file_size - pos - sizeof(size) < size)
+            break;
+
+        if (visit)
+        {
+            std::vector<char> data(size);
+            in.read(data.data(), data.size());
+            if (!in)
+                break;
+
+            visit(data);
+        }
+        else
+        {
+            in.seekg(size, std::ios::cur);
+        }
+
+        pos += sizeof(size) + size;
+    }
+
+    return pos;
+}
+}
+
+cdc_stream::cdc_stream()
+{
+}
+
+cdc_stream::~cdc_stream()
+{
+    close();
+}
+
+void cdc_stream::open(const fc::path& file)
+{
+    close();
+
+    _file = file;
+
+    bool is_new = true;
+
+    if (boost::filesystem::exists(_file))
+    {
+        FC_ASSERT(boost::filesystem::is_regular_file(_file), "${f} is not a regular file", ("f", _file));
+
+        const uint64_t file_size = boost::filesystem::file_size(_file);
+        uint64_t valid_size = 0;
+        {
+            std::ifstream in(_file.generic_string().c_str(), std::ios::binary);
+
+            check_magic(in, file_size, _file);
+
+            if (file_size >= sizeof(stream_magic))
+            {
+                valid_size = for_each_frame(in, file_size, nullptr);
+                is_new = false;
+            }
+        }
+
+        // a record is written by several calls, the node could crash in the middle of it
+        if (valid_size < file_size)
+        {
+            wlog("Truncating ${n} bytes of a partial record at the end of ${f}",
+                 ("n", file_size - valid_size)("f", _file));
+            boost::filesystem::resize_file(_file, valid_size);
+        }
+    }
+    else
+    {
+        boost::filesystem::create_directories(_file.parent_path());
+    }
+
+    _out.open(_file.generic_string().c_str(), std::ios::binary | std::ios::app);
+    FC_ASSERT(_out.good(), "Could not open ${f}", ("f", _file));
+
+    if (is_new)
+    {
+        _out.write(stream_magic, sizeof(stream_magic));
+        flush();
+    }
+}
+
+void cdc_stream::close()
+{
+    if (_out.is_open())
+    {
+        _out.flush();
+        _out.close();
+    }
+}
+
+bool cdc_stream::is_open() const
+{
+    return _out.is_open();
+}
+
+void cdc_stream::write(const cdc_record& record)
+{
+    FC_ASSERT(is_open());
+
+    const std::vector<char> data = fc::raw::pack(record);
+    const uint32_t size = data.size();
+
+    _out.write((const char*)&size, sizeof(size));
+    _out.write(data.data(), data.size());
+
+    FC_ASSERT(_out.good(), "Could not write to ${f}", ("f", _file));
+}
+
+void cdc_stream::flush()
+{
+    FC_ASSERT(is_open());
+
+    _out.flush();
+
+    FC_ASSERT(_out.good(), "Could not write to ${f}", ("f", _file));
+}
+
+std::vector<cdc_record> read_cdc_stream(const fc::path& file)
+{
+    std::vector<cdc_record> records;
+
+    const uint64_t file_size = boost::filesystem::file_size(file);
+
+    std::ifstream in(file.generic_string().c_str(), std::ios::binary);
+    FC_ASSERT(in.good(), "Could not open ${f}", ("f", file));
+
+    check_magic(in, file_size, file);
+
+    if (file_size >= sizeof(stream_magic))
+    {
+        for_each_frame(in, file_size,
+                       [&](const std::vector<char>& data) { records.push_back(fc::raw::unpack<cdc_record>(data)); });
+    }
+
+    return records;
+}
+}
+}
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <scorum/chain/schema/scorum_object_types.hpp>
+
+#include <fc/static_variant.hpp>
+
+#include <vector>
+
+namespace scorum {
+namespace plugin {
+namespace cdc {
+
+enum class object_change_type : uint8_t
+{
+    created,
+    modified,
+    removed
+};
+
+struct object_change
+{
+    object_change_type type = object_change_type::created;
+
+    /// chainbase type id of the object (scorum::chain::object_type)
+    uint16_t object_type = 0;
+    int64_t object_id = 0;
+
+    /// fc::raw packed object, the last value of the object for the removed ones
+    std::vector<char> value;
+};
+
+/**
+ * State changes made by the block, the final value of each changed object. An object appears in the changes once.
+ */
+struct applied_block_record
+{
+    uint32_t block_num = 0;
+    chain::block_id_type block_id;
+    fc::time_point_sec timestamp;
+
+    std::vector<object_change> changes;
+};
+
+/**
+ * The block has been popped (fork switch), its changes are undone and must be reverted by consumers.
+ */
+struct popped_block_record
+{
+    uint32_t block_num = 0;
+    chain::block_id_type block_id;
+};
+
+/**
+ * Blocks up to block_num (inclusive) are irreversible, they will never be popped.
+ */
+struct irreversible_block_record
+{
+    uint32_t block_num = 0;
+};
+
+using cdc_record = fc::static_variant<applied_block_record, popped_block_record, irreversible_block_record>;
+}
+}
+}
+
+// clang-format off
+
+FC_REFLECT_ENUM( scorum::plugin::cdc::object_change_type,
+   (created)
+   (modified)
+   (removed)
+   )
+
+FC_REFLECT( scorum::plugin::cdc::object_change,
+   (type)
+   (object_type)
+   (object_id)
+   (value)
+   )
+
+FC_REFLECT( scorum::plugin::cdc::applied_block_record,
+   (block_num)
+   (block_id)
+   (timestamp)
+   (changes)
+   )
+
+FC_REFLECT( scorum::plugin::cdc::popped_block_record,
+   (block_num)
+   (block_id)
+   )
+
+FC_REFLECT( scorum::plugin::cdc::irreversible_block_record,
+   (block_num)
+   )
+
+// clang-format on
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <scorum/app/plugin.hpp>
+#include <scorum/plugins/cdc/cdc_stream.hpp>
+
+#include <string>
+
+namespace scorum {
+namespace protocol {
+struct signed_block;
+}
+}
+
+namespace scorum {
+namespace plugin {
+namespace cdc {
+
+using scorum::app::application;
+
+/**
+ * Change data capture: streams state changes of the chain objects block by block (see cdc_stream.hpp).
+ *
+ * Changes are taken from the undo state of the applied block, so the stream follows forks: the records of a
+ * popped block are followed by popped_block_record. irreversible_block_record is written when the last
+ * irreversible block moves. Objects of plugins are not streamed.
+ */
+class cdc_plugin : public scorum::app::plugin
+{
+public:
+    cdc_plugin(application* app);
+    virtual ~cdc_plugin();
+
+    virtual std::string plugin_name() const override;
+    virtual void plugin_set_program_options(boost::program_options::options_description& cli,
+                                            boost::program_options::options_description& cfg) override;
+    virtual void plugin_initialize(const boost::program_options::variables_map& options) override;
+    virtual void plugin_startup() override;
+    virtual void plugin_shutdown() override;
+
+private:
+    void on_applied_block(const chain::signed_block& b);
+    void on_popped_block(const chain::signed_block& b);
+
+    cdc_stream _stream;
+
+    uint32_t _last_irreversible_block_num = 0;
+    bool _is_replay_reported = false;
+
+    boost::signals2::scoped_connection _applied_block_conn;
+    boost::signals2::scoped_connection _popped_block_conn;
+};
+}
+}
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <scorum/plugins/cdc/cdc_objects.hpp>
+
+#include <fc/filesystem.hpp>
+
+#include <fstream>
+#include <vector>
+
+namespace scorum {
+namespace plugin {
+namespace cdc {
+
+/**
+ * Append only file of cdc records. The file starts with the 8 bytes magic "SCRCDC01", then records follow as
+ * frames of the fc::raw packed cdc_record prefixed with its 32 bit little endian size:
+ *
+ *     [uint32 size][cdc_record] [uint32 size][cdc_record] ...
+ *
+ * Records are written in the order the node applies and pops blocks. Only a regular file is supported: writes are
+ * done by the block application, so the stream must never block the node on a slow reader. A partial frame left at
+ * the end of the file by a crash is truncated on open.
+ */
+class cdc_stream
+{
+public:
+    cdc_stream();
+    ~cdc_stream();
+
+    void open(const fc::path& file);
+    void close();
+    bool is_open() const;
+
+    void write(const cdc_record& record);
+
+    /// called at the end of each block, so consumers never wait for the records of the applied block
+    void flush();
+
+private:
+    fc::path _file;
+    std::ofstream _out;
+};
+
+/// reads all complete records of the stream, a partial frame at the end of the file is ignored
+std::vector<cdc_record> read_cdc_stream(const fc::path& file);
+}
+}
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 
 #include <scorum/protocol/types.hpp>
@@ -15,6 +16,7 @@ namespace scorum {
 namespace tags {
 
 class tags_api_impl;
+struct tags_api_cache;
 
 class tags_api : public std::enable_shared_from_this<tags_api>
 {
@@ -22,8 +24,14 @@ class tags_api : public std::enable_shared_from_this<tags_api>
 
     std::shared_ptr<chainbase::database_guard> _guard;
 
+    std::shared_ptr<tags_api_cache> _cache;
+
     chainbase::database_guard& guard() const;
 
+    std::vector<api::discussion> get_discussions(const std::string& method,
+                                                 const api::discussion_query& query,
+                                                 std::function<std::vector<api::discussion>()> get) const;
+
 public:
     tags_api(const app::api_context& ctx);
     ~tags_api();
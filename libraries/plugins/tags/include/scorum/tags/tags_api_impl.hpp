@@ -8,6 +8,7 @@
 
 #include <scorum/chain/data_service_factory.hpp>
 #include <scorum/chain/services/comment.hpp>
+#include <scorum/chain/services/comment_content.hpp>
 #include <scorum/chain/services/reward_funds.hpp>
 #include <scorum/chain/services/comment_vote.hpp>
 #include <scorum/chain/services/account.hpp>
@@ -93,7 +94,7 @@ public:
         auto tidx_itr = tidx.lower_bound(tag);
 
         return get_discussions(query, tag, parent, tidx, tidx_itr, query.truncate_body,
-                               [](const comment_api_obj& c) { return c.net_rshares <= 0; }, exit_default,
+                               [](const comment_object& c) { return c.net_rshares <= 0; }, exit_default,
                                tag_exit_default, true);
     }
 
@@ -107,7 +108,7 @@ public:
         auto tidx_itr = tidx.lower_bound(boost::make_tuple(tag, true));
 
         return get_discussions(query, tag, parent, tidx, tidx_itr, query.truncate_body,
-                               [](const comment_api_obj& c) { return c.net_rshares <= 0; }, exit_default,
+                               [](const comment_object& c) { return c.net_rshares <= 0; }, exit_default,
                                tag_exit_default, true);
     }
 
@@ -121,7 +122,7 @@ public:
         auto tidx_itr = tidx.lower_bound(boost::make_tuple(tag, false));
 
         return get_discussions(query, tag, parent, tidx, tidx_itr, query.truncate_body,
-                               [](const comment_api_obj& c) { return c.net_rshares <= 0; }, exit_default,
+                               [](const comment_object& c) { return c.net_rshares <= 0; }, exit_default,
                                tag_exit_default, true);
     }
 
@@ -135,7 +136,7 @@ public:
         auto tidx_itr = tidx.lower_bound(boost::make_tuple(tag, parent, std::numeric_limits<double>::max()));
 
         return get_discussions(query, tag, parent, tidx, tidx_itr, query.truncate_body,
-                               [](const comment_api_obj& c) { return c.net_rshares <= 0; });
+                               [](const comment_object& c) { return c.net_rshares <= 0; });
     }
 
     std::vector<discussion> get_discussions_by_created(const discussion_query& query) const
@@ -160,7 +161,7 @@ public:
         auto tidx_itr = tidx.lower_bound(boost::make_tuple(tag, parent, std::numeric_limits<double>::max()));
 
         return get_discussions(query, tag, parent, tidx, tidx_itr, query.truncate_body,
-                               [](const comment_api_obj& c) { return c.net_rshares <= 0; });
+                               [](const comment_object& c) { return c.net_rshares <= 0; });
     }
 
     std::vector<discussion> get_discussions_by_promoted(const discussion_query& query) const
@@ -200,7 +201,7 @@ public:
         auto tidx_itr = tidx.lower_bound(boost::make_tuple(tag, fc::time_point::now() - fc::minutes(60)));
 
         return get_discussions(query, tag, parent, tidx, tidx_itr, query.truncate_body,
-                               [](const comment_api_obj& c) { return c.net_rshares < 0; });
+                               [](const comment_object& c) { return c.net_rshares < 0; });
     }
 
     std::vector<discussion> get_discussions_by_votes(const discussion_query& query) const
@@ -278,6 +279,7 @@ public:
         if (itr != by_permlink_idx.end())
         {
             discussion result(*itr);
+            set_content(result);
             set_pending_payout(result);
             result.active_votes = get_active_votes(author, permlink);
             return result;
@@ -295,6 +297,7 @@ public:
                && fc::to_string(itr->parent_permlink) == parent_permlink)
         {
             result.push_back(discussion(*itr));
+            set_content(result.back());
             set_pending_payout(result.back());
             ++itr;
         }
@@ -516,6 +519,7 @@ public:
                 q.tag = tag;
                 q.limit = 20;
                 q.truncate_body = 1024;
+                q.votes_limit = 0;
                 auto trending_disc = get_discussions_by_trending(q);
 
                 auto& didx = _state.discussion_idx[tag];
@@ -534,6 +538,7 @@ public:
                 q.tag = tag;
                 q.limit = 20;
                 q.truncate_body = 1024;
+                q.votes_limit = 0;
                 auto trending_disc = get_post_discussions_by_payout(q);
 
                 auto& didx = _state.discussion_idx[tag];
@@ -552,6 +557,7 @@ public:
                 q.tag = tag;
                 q.limit = 20;
                 q.truncate_body = 1024;
+                q.votes_limit = 0;
                 auto trending_disc = get_comment_discussions_by_payout(q);
 
                 auto& didx = _state.discussion_idx[tag];
@@ -570,6 +576,7 @@ public:
                 q.tag = tag;
                 q.limit = 20;
                 q.truncate_body = 1024;
+                q.votes_limit = 0;
                 auto trending_disc = get_discussions_by_promoted(q);
 
                 auto& didx = _state.discussion_idx[tag];
@@ -588,6 +595,7 @@ public:
                 q.tag = tag;
                 q.limit = 20;
                 q.truncate_body = 1024;
+                q.votes_limit = 0;
                 auto trending_disc = get_discussions_by_children(q);
 
                 auto& didx = _state.discussion_idx[tag];
@@ -606,6 +614,7 @@ public:
                 q.tag = tag;
                 q.limit = 20;
                 q.truncate_body = 1024;
+                q.votes_limit = 0;
                 auto trending_disc = get_discussions_by_hot(q);
 
                 auto& didx = _state.discussion_idx[tag];
@@ -624,6 +633,7 @@ public:
                 q.tag = tag;
                 q.limit = 20;
                 q.truncate_body = 1024;
+                q.votes_limit = 0;
                 auto trending_disc = get_discussions_by_promoted(q);
 
                 auto& didx = _state.discussion_idx[tag];
@@ -642,6 +652,7 @@ public:
                 q.tag = tag;
                 q.limit = 20;
                 q.truncate_body = 1024;
+                q.votes_limit = 0;
                 auto trending_disc = get_discussions_by_votes(q);
 
                 auto& didx = _state.discussion_idx[tag];
@@ -660,6 +671,7 @@ public:
                 q.tag = tag;
                 q.limit = 20;
                 q.truncate_body = 1024;
+                q.votes_limit = 0;
                 auto trending_disc = get_discussions_by_cashout(q);
 
                 auto& didx = _state.discussion_idx[tag];
@@ -678,6 +690,7 @@ public:
                 q.tag = tag;
                 q.limit = 20;
                 q.truncate_body = 1024;
+                q.votes_limit = 0;
                 auto trending_disc = get_discussions_by_active(q);
 
                 auto& didx = _state.discussion_idx[tag];
@@ -696,6 +709,7 @@ public:
                 q.tag = tag;
                 q.limit = 20;
                 q.truncate_body = 1024;
+                q.votes_limit = 0;
                 auto trending_disc = get_discussions_by_created(q);
 
                 auto& didx = _state.discussion_idx[tag];
@@ -714,6 +728,7 @@ public:
                 q.tag = tag;
                 q.limit = 20;
                 q.truncate_body = 1024;
+                q.votes_limit = 0;
                 auto trending_disc = get_discussions_by_created(q);
 
                 auto& didx = _state.discussion_idx[tag];
@@ -767,12 +782,12 @@ private:
     scorum::chain::data_service_factory_i& _services;
     tags_service _tags_service;
 
-    static bool filter_default(const comment_api_obj&)
+    static bool filter_default(const comment_object&)
     {
         return false;
     }
 
-    static bool exit_default(const comment_api_obj&)
+    static bool exit_default(const comment_object&)
     {
         return false;
     }
@@ -799,32 +814,72 @@ private:
         return _services.comment_service().get(parent_author, parent_permlink).id;
     }
 
+    void set_content(comment_api_obj& d) const
+    {
+        const comment_content_object* content = _services.comment_content_service().find(d.id);
+        if (content)
+            d.set_comment_content(*content);
+    }
+
     void set_url(discussion& d) const
     {
         const api::comment_api_obj root(_services.comment_service().get(d.root_comment));
         d.url = "/" + root.category + "/@" + root.author + "/" + root.permlink;
-        d.root_title = root.title;
         if (root.id != d.id)
             d.url += "#@" + d.author + "/" + d.permlink;
+
+        const comment_content_object* root_content = _services.comment_content_service().find(d.root_comment);
+        if (root_content)
+            d.root_title = fc::to_string(root_content->title);
     }
 
-    discussion get_discussion(comment_id_type id, uint32_t truncate_body = 0) const
+    /// copies only the first truncate_body bytes of the body (all if 0), body_length is the size of the whole body
+    void set_content(discussion& d, uint32_t truncate_body) const
     {
-        discussion d = _services.comment_service().get(id);
+        const comment_content_object* content = _services.comment_content_service().find(d.id);
+        if (!content)
+            return;
 
-        set_url(d);
-        set_pending_payout(d);
+        d.title = fc::to_string(content->title);
+        d.json_metadata = fc::to_string(content->json_metadata);
+
+        const char* pruned = get_pruned_body(d, content->body.size());
+        if (pruned)
+        {
+            d.body = pruned;
+        }
+        else
+        {
+            size_t size = content->body.size();
+            if (truncate_body)
+                size = std::min<size_t>(size, truncate_body);
+
+            d.body.assign(content->body.data(), size);
+        }
 
-        d.active_votes = get_active_votes(d.author, d.permlink);
-        d.body_length = d.body.size();
+        d.body_length = pruned ? d.body.size() : content->body.size();
 
         if (truncate_body)
         {
-            d.body = d.body.substr(0, truncate_body);
+            if (d.body.size() > truncate_body)
+                d.body.resize(truncate_body);
 
             if (!fc::is_utf8(d.body))
                 d.body = fc::prune_invalid_utf8(d.body);
         }
+    }
+
+    discussion get_discussion(comment_id_type id,
+                              uint32_t truncate_body = 0,
+                              optional<uint32_t> votes_limit = optional<uint32_t>()) const
+    {
+        discussion d = _services.comment_service().get(id);
+
+        set_content(d, truncate_body);
+        set_pending_payout(d);
+
+        if (!votes_limit || *votes_limit > 0)
+            d.active_votes = get_active_votes(id, votes_limit);
 
         return d;
     }
@@ -873,24 +928,40 @@ private:
         if (d.parent_author != SCORUM_ROOT_POST_PARENT_ACCOUNT)
             d.cashout_time = _tags_service.calculate_discussion_payout_time(_services.comment_service().get(d.id));
 
-        if (d.body.size() > 1024 * 128)
-            d.body = "body pruned due to size";
-        if (d.parent_author.size() > 0 && d.body.size() > 1024 * 16)
-            d.body = "comment pruned due to size";
+        const char* pruned = get_pruned_body(d, d.body.size());
+        if (pruned)
+            d.body = pruned;
 
         set_url(d);
     }
 
+    static const char* get_pruned_body(const comment_api_obj& d, size_t body_size)
+    {
+        if (body_size > 1024 * 128)
+            return "body pruned due to size";
+        if (d.parent_author.size() > 0 && body_size > 1024 * 16)
+            return "comment pruned due to size";
+
+        return nullptr;
+    }
+
     std::vector<api::vote_state> get_active_votes(const std::string& author, const std::string& permlink) const
     {
-        std::vector<api::vote_state> result;
-        const auto& comment = _services.comment_service().get(author, permlink);
+        return get_active_votes(_services.comment_service().get(author, permlink).id);
+    }
 
-        auto votes = _services.comment_vote_service().get_by_comment(comment.id);
+    std::vector<api::vote_state> get_active_votes(comment_id_type comment,
+                                                  optional<uint32_t> limit = optional<uint32_t>()) const
+    {
+        std::vector<api::vote_state> result;
 
-        for (auto it = votes.begin(); it != votes.end(); ++it)
+        const auto& vote_idx = _db.get_index<comment_vote_index>().indices().get<by_comment_voter>();
+        for (auto it = vote_idx.lower_bound(comment); it != vote_idx.end() && it->comment == comment; ++it)
         {
-            const auto comment_voute = it->get();
+            if (limit && result.size() >= *limit)
+                break;
+
+            const auto& comment_voute = *it;
             const auto& vouter = _services.account_service().get(comment_voute.voter);
 
             api::vote_state vstate;
@@ -913,8 +984,8 @@ private:
                                             const Index& tidx,
                                             StartItr tidx_itr,
                                             uint32_t truncate_body = 0,
-                                            const std::function<bool(const comment_api_obj&)>& filter = &filter_default,
-                                            const std::function<bool(const comment_api_obj&)>& exit = &exit_default,
+                                            const std::function<bool(const comment_object&)>& filter = &filter_default,
+                                            const std::function<bool(const comment_object&)>& exit = &exit_default,
                                             const std::function<bool(const tag_object&)>& tag_exit = &tag_exit_default,
                                             bool ignore_parent = false) const
     {
@@ -958,21 +1029,23 @@ private:
                 break;
             try
             {
-                result.push_back(get_discussion(tidx_itr->comment, truncate_body));
-                result.back().promoted = asset(tidx_itr->promoted_balance, SCORUM_SYMBOL);
+                // filters are checked on the comment itself, only accepted discussions are materialized
+                const comment_object& comment = _services.comment_service().get(tidx_itr->comment);
 
-                if (filter(result.back()))
+                if (filter(comment))
                 {
-                    result.pop_back();
                     ++filter_count;
                 }
-                else if (exit(result.back()) || tag_exit(*tidx_itr))
+                else if (exit(comment) || tag_exit(*tidx_itr))
                 {
-                    result.pop_back();
                     break;
                 }
                 else
+                {
+                    result.push_back(get_discussion(tidx_itr->comment, truncate_body, query.votes_limit));
+                    result.back().promoted = asset(tidx_itr->promoted_balance, SCORUM_SYMBOL);
                     --count;
+                }
             }
             catch (const fc::exception& e)
             {
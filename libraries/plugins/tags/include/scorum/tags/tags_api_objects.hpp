@@ -27,6 +27,7 @@ using scorum::protocol::share_type;
 using scorum::chain::comment_id_type;
 using scorum::chain::beneficiary_route_type;
 using scorum::chain::comment_object;
+using scorum::chain::comment_content_object;
 using scorum::chain::account_object;
 
 using scorum::app::dynamic_global_property_api_obj;
@@ -95,6 +96,9 @@ struct comment_api_obj
     bool allow_curation_rewards = false;
     std::vector<beneficiary_route_type> beneficiaries;
 
+    /// title, body and json_metadata are stored apart from comment_object and are read only when requested
+    void set_comment_content(const chain::comment_content_object& content);
+
 private:
     void set_comment(const chain::comment_object& o);
     void set_comment_statistic(const chain::comment_statistic_scr_object& stat);
@@ -200,6 +204,9 @@ struct discussion_query
     // the number of bytes of the post body to return, 0 for all
     uint32_t truncate_body = 0;
 
+    // the max number of active votes to return for each discussion, all if not set
+    optional<uint32_t> votes_limit;
+
     optional<std::string> start_author;
     optional<std::string> start_permlink;
     optional<std::string> parent_author;
@@ -339,5 +346,6 @@ FC_REFLECT(scorum::tags::api::discussion_query,
           (start_permlink)
           (parent_author)
           (parent_permlink)
-          (limit))
+          (limit)
+          (votes_limit))
 // clang-format on
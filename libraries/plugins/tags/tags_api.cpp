@@ -2,6 +2,11 @@
 
 #include <scorum/tags/tags_api_impl.hpp>
 
+#include <scorum/app/application.hpp>
+#include <scorum/app/versioned_cache.hpp>
+
+#include <fc/io/json.hpp>
+
 namespace scorum {
 namespace tags {
 
@@ -9,6 +14,27 @@ using namespace scorum::chain;
 using namespace scorum::protocol;
 using namespace scorum::tags::api;
 
+/**
+ * Discussion queries are the most requested ones by front-ends, the same queries are repeated by all visitors of
+ * the same page, so results are shared by all connections until the chain state is changed.
+ */
+struct tags_api_cache
+{
+    // discussions keep full bodies if truncate_body is not set, so the cache is limited by their size as well
+    app::versioned_cache<std::string, std::vector<discussion>> discussions{ 1000, 64 * 1024 * 1024, &size_of };
+
+    static size_t size_of(const std::string& key, const std::vector<discussion>& value)
+    {
+        size_t size = key.size();
+        for (const discussion& d : value)
+        {
+            size += sizeof(discussion) + d.title.size() + d.body.size() + d.json_metadata.size()
+                + d.active_votes.size() * sizeof(d.active_votes[0]);
+        }
+        return size;
+    }
+};
+
 chainbase::database_guard& tags_api::guard() const
 {
     return *_guard;
@@ -17,6 +43,7 @@ chainbase::database_guard& tags_api::guard() const
 tags_api::tags_api(const app::api_context& ctx)
     : _impl(new tags_api_impl(*ctx.app.chain_database()))
     , _guard(ctx.app.chain_database())
+    , _cache(ctx.app.get_shared_api_state<tags_api_cache>(TAGS_API_NAME))
 {
 }
 
@@ -28,6 +55,15 @@ void tags_api::on_api_startup()
 {
 }
 
+std::vector<discussion> tags_api::get_discussions(const std::string& method,
+                                                 const discussion_query& query,
+                                                 std::function<std::vector<discussion>()> get) const
+{
+    return guard().with_read_lock([&]() {
+        return _cache->discussions.get(method + fc::json::to_string(query), guard().write_generation(), get);
+    });
+}
+
 std::vector<tag_api_obj> tags_api::get_trending_tags(const std::string& after_tag, uint32_t limit) const
 {
     return guard().with_read_lock([&]() { return _impl->get_trending_tags(after_tag, limit); });
@@ -40,62 +76,74 @@ std::vector<std::pair<std::string, uint32_t>> tags_api::get_tags_used_by_author(
 
 std::vector<discussion> tags_api::get_discussions_by_payout(const discussion_query& query) const
 {
-    return guard().with_read_lock([&]() { return _impl->get_discussions_by_payout(query); });
+    return get_discussions("get_discussions_by_payout", query,
+                           [&]() { return _impl->get_discussions_by_payout(query); });
 }
 
 std::vector<discussion> tags_api::get_post_discussions_by_payout(const discussion_query& query) const
 {
-    return guard().with_read_lock([&]() { return _impl->get_post_discussions_by_payout(query); });
+    return get_discussions("get_post_discussions_by_payout", query,
+                           [&]() { return _impl->get_post_discussions_by_payout(query); });
 }
 
 std::vector<discussion> tags_api::get_comment_discussions_by_payout(const discussion_query& query) const
 {
-    return guard().with_read_lock([&]() { return _impl->get_comment_discussions_by_payout(query); });
+    return get_discussions("get_comment_discussions_by_payout", query,
+                           [&]() { return _impl->get_comment_discussions_by_payout(query); });
 }
 
 std::vector<discussion> tags_api::get_discussions_by_trending(const discussion_query& query) const
 {
-    return guard().with_read_lock([&]() { return _impl->get_comment_discussions_by_payout(query); });
+    return get_discussions("get_comment_discussions_by_payout", query,
+                           [&]() { return _impl->get_comment_discussions_by_payout(query); });
 }
 
 std::vector<discussion> tags_api::get_discussions_by_created(const discussion_query& query) const
 {
-    return guard().with_read_lock([&]() { return _impl->get_discussions_by_created(query); });
+    return get_discussions("get_discussions_by_created", query,
+                           [&]() { return _impl->get_discussions_by_created(query); });
 }
 
 std::vector<discussion> tags_api::get_discussions_by_active(const discussion_query& query) const
 {
-    return guard().with_read_lock([&]() { return _impl->get_discussions_by_active(query); });
+    return get_discussions("get_discussions_by_active", query,
+                           [&]() { return _impl->get_discussions_by_active(query); });
 }
 
 std::vector<discussion> tags_api::get_discussions_by_cashout(const discussion_query& query) const
 {
-    return guard().with_read_lock([&]() { return _impl->get_discussions_by_cashout(query); });
+    return get_discussions("get_discussions_by_cashout", query,
+                           [&]() { return _impl->get_discussions_by_cashout(query); });
 }
 
 std::vector<discussion> tags_api::get_discussions_by_votes(const discussion_query& query) const
 {
-    return guard().with_read_lock([&]() { return _impl->get_discussions_by_votes(query); });
+    return get_discussions("get_discussions_by_votes", query,
+                           [&]() { return _impl->get_discussions_by_votes(query); });
 }
 
 std::vector<discussion> tags_api::get_discussions_by_children(const discussion_query& query) const
 {
-    return guard().with_read_lock([&]() { return _impl->get_discussions_by_children(query); });
+    return get_discussions("get_discussions_by_children", query,
+                           [&]() { return _impl->get_discussions_by_children(query); });
 }
 
 std::vector<discussion> tags_api::get_discussions_by_hot(const discussion_query& query) const
 {
-    return guard().with_read_lock([&]() { return _impl->get_discussions_by_hot(query); });
+    return get_discussions("get_discussions_by_hot", query,
+                           [&]() { return _impl->get_discussions_by_hot(query); });
 }
 
 std::vector<discussion> tags_api::get_discussions_by_comments(const discussion_query& query) const
 {
-    return guard().with_read_lock([&]() { return _impl->get_discussions_by_comments(query); });
+    return get_discussions("get_discussions_by_comments", query,
+                           [&]() { return _impl->get_discussions_by_comments(query); });
 }
 
 std::vector<discussion> tags_api::get_discussions_by_promoted(const discussion_query& query) const
 {
-    return guard().with_read_lock([&]() { return _impl->get_discussions_by_promoted(query); });
+    return get_discussions("get_discussions_by_promoted", query,
+                           [&]() { return _impl->get_discussions_by_promoted(query); });
 }
 
 discussion tags_api::get_content(const std::string& author, const std::string& permlink) const
@@ -30,9 +30,6 @@ void comment_api_obj::set_comment(const chain::comment_object& o)
     parent_permlink = fc::to_string(o.parent_permlink);
     author = o.author;
     permlink = fc::to_string(o.permlink);
-    title = fc::to_string(o.title);
-    body = fc::to_string(o.body);
-    json_metadata = fc::to_string(o.json_metadata);
     last_update = o.last_update;
     created = o.created;
     active = o.active;
@@ -53,6 +50,13 @@ void comment_api_obj::set_comment(const chain::comment_object& o)
     allow_curation_rewards = o.allow_curation_rewards;
 }
 
+void comment_api_obj::set_comment_content(const chain::comment_content_object& content)
+{
+    title = fc::to_string(content.title);
+    body = fc::to_string(content.body);
+    json_metadata = fc::to_string(content.json_metadata);
+}
+
 void comment_api_obj::set_comment_statistic(const chain::comment_statistic_scr_object& stat)
 {
     total_payout_scr_value = stat.total_payout_value;
@@ -13,6 +13,7 @@
 #include <scorum/chain/schema/comment_objects.hpp>
 #include <scorum/chain/services/account.hpp>
 #include <scorum/chain/services/comment.hpp>
+#include <scorum/chain/services/comment_content.hpp>
 
 #include <fc/smart_ref_impl.hpp>
 #include <fc/thread/thread.hpp>
@@ -123,11 +124,12 @@ struct operation_visitor
     {
         comment_metadata meta;
 
-        if (c.json_metadata.size())
+        const comment_content_object* content = _db.obtain_service<dbs_comment_content>().find(c.id);
+        if (content && content->json_metadata.size())
         {
             try
             {
-                meta = fc::json::from_string(fc::to_string(c.json_metadata)).as<comment_metadata>();
+                meta = fc::json::from_string(fc::to_string(content->json_metadata)).as<comment_metadata>();
             }
             catch (const fc::exception&)
             {
@@ -547,6 +549,28 @@ void tags_plugin::plugin_initialize(const boost::program_options::variables_map&
 void tags_plugin::plugin_startup()
 {
     app().register_api_factory<tags_api>("tags_api");
+
+    app().register_binary_api("tags_api", [](const fc::api_ptr& ptr) {
+        auto api = ptr->as<tags_api>();
+
+        using scorum::app::make_binary_method;
+
+        scorum::app::binary_api_methods methods;
+        methods["get_discussions_by_payout"] = make_binary_method(api->get_discussions_by_payout);
+        methods["get_post_discussions_by_payout"] = make_binary_method(api->get_post_discussions_by_payout);
+        methods["get_comment_discussions_by_payout"] = make_binary_method(api->get_comment_discussions_by_payout);
+        methods["get_discussions_by_trending"] = make_binary_method(api->get_discussions_by_trending);
+        methods["get_discussions_by_created"] = make_binary_method(api->get_discussions_by_created);
+        methods["get_discussions_by_hot"] = make_binary_method(api->get_discussions_by_hot);
+        methods["get_discussions_by_promoted"] = make_binary_method(api->get_discussions_by_promoted);
+        methods["get_discussions_by_active"] = make_binary_method(api->get_discussions_by_active);
+        methods["get_discussions_by_cashout"] = make_binary_method(api->get_discussions_by_cashout);
+        methods["get_discussions_by_votes"] = make_binary_method(api->get_discussions_by_votes);
+        methods["get_discussions_by_children"] = make_binary_method(api->get_discussions_by_children);
+        methods["get_discussions_by_comments"] = make_binary_method(api->get_discussions_by_comments);
+        methods["get_content_replies"] = make_binary_method(api->get_content_replies);
+        return methods;
+    });
 }
 
 } // namespace tags
@@ -21,6 +21,7 @@ namespace wallet {
 
 using scorum::blockchain_history::applied_operation;
 using scorum::blockchain_history::applied_operation_type;
+using scorum::blockchain_history::applied_operation_map_type;
 using scorum::blockchain_history::signed_block_api_obj;
 
 using transaction_handle_type = uint16_t;
@@ -153,8 +154,7 @@ public:
      * @param block_num Block height of specified block
      * @param type_of_operation Operations type (all = 0, not_virt = 1, virt = 2, market = 3)
      */
-    std::map<uint32_t, applied_operation> get_ops_in_block(uint32_t block_num,
-                                                           applied_operation_type type_of_operation) const;
+    applied_operation_map_type get_ops_in_block(uint32_t block_num, applied_operation_type type_of_operation) const;
 
     /**
      *  This method returns all operations in ids range [from-limit, from]
@@ -163,7 +163,7 @@ public:
      *  @param limit - the maximum number of items that can be queried (0 to 100], must be less than from
      *  @param type_of_operation Operations type (all = 0, not_virt = 1, virt = 2, market = 3)
      */
-    std::map<uint32_t, applied_operation>
+    applied_operation_map_type
     get_ops_history(uint32_t from_op, uint32_t limit, applied_operation_type type_of_operation) const;
 
     /**
@@ -53,6 +53,7 @@
 #include <fc/crypto/hex.hpp>
 #include <fc/thread/mutex.hpp>
 #include <fc/thread/scoped_lock.hpp>
+#include <fc/thread/thread.hpp>
 #include <fc/smart_ref_impl.hpp>
 
 #ifndef WIN32
@@ -283,11 +284,67 @@ public:
 
     account_api_obj get_account(const std::string& account_name) const
     {
-        auto accounts = _remote_db->get_accounts({ account_name });
+        auto accounts = get_accounts({ account_name });
         FC_ASSERT(!accounts.empty(), "Unknown account");
         return accounts.front();
     }
 
+    // Returns existing accounts in the order of names. Accounts fetched during the last block interval are taken
+    // from the cache, the rest are requested from the node in a single call, so a command and the signing of its
+    // transaction cost one round trip for all involved accounts.
+    std::vector<account_api_obj> get_accounts(const std::vector<std::string>& names) const
+    {
+        const fc::time_point now = fc::time_point::now();
+
+        std::vector<std::string> missing;
+        for (const auto& name : names)
+        {
+            auto it = _accounts_cache.find(name);
+            if (it == _accounts_cache.end() || it->second.first + _cache_ttl < now)
+                missing.push_back(name);
+        }
+
+        if (!missing.empty())
+        {
+            if (_accounts_cache.size() + missing.size() > _accounts_cache_max_size)
+                _accounts_cache.clear();
+
+            for (const auto& account : _remote_db->get_accounts(missing))
+                _accounts_cache[account.name] = std::make_pair(now, account_api_obj(account));
+        }
+
+        std::vector<account_api_obj> result;
+        result.reserve(names.size());
+        for (const auto& name : names)
+        {
+            auto it = _accounts_cache.find(name);
+            if (it != _accounts_cache.end())
+                result.push_back(it->second.second);
+        }
+
+        return result;
+    }
+
+    dynamic_global_property_api_obj get_dynamic_global_properties() const
+    {
+        const fc::time_point now = fc::time_point::now();
+
+        if (_dynamic_props_time + _cache_ttl < now)
+        {
+            _dynamic_props = _remote_db->get_dynamic_global_properties();
+            _dynamic_props_time = now;
+        }
+
+        return _dynamic_props;
+    }
+
+    // must be called after broadcasting, the transaction could change any of the cached objects
+    void reset_cache()
+    {
+        _accounts_cache.clear();
+        _dynamic_props_time = fc::time_point();
+    }
+
     std::string get_wallet_filename() const
     {
         return _wallet_filename;
@@ -460,6 +517,7 @@ public:
             {
                 //_remote_net_broadcast->broadcast_transaction( tx );
                 auto result = _remote_net_broadcast->broadcast_transaction_synchronous(tx);
+                reset_cache();
             }
             return tx;
         }
@@ -520,7 +578,11 @@ public:
 
         /// TODO: fetch the accounts specified via other_auths as well.
 
-        auto approving_account_objects = _remote_db->get_accounts(v_approving_account_names);
+        // reference block is requested concurrently with the accounts, both requests are sent without waiting
+        // for each other's response
+        auto dyn_props_future = fc::async([this]() { return get_dynamic_global_properties(); });
+
+        auto approving_account_objects = get_accounts(v_approving_account_names);
 
         /// TODO: recursively check one layer deeper in the authority tree for keys
 
@@ -595,7 +657,7 @@ public:
             }
         }
 
-        auto dyn_props = _remote_db->get_dynamic_global_properties();
+        auto dyn_props = dyn_props_future.wait();
         tx.set_reference_block(dyn_props.head_block_id);
         tx.set_expiration(dyn_props.time + fc::seconds(_tx_expiration_seconds));
         tx.signatures.clear();
@@ -646,6 +708,7 @@ public:
             try
             {
                 auto result = _remote_net_broadcast->broadcast_transaction_synchronous(tx);
+                reset_cache();
                 annotated_signed_transaction rtrx(tx);
                 rtrx.block_num = result.get_object()["block_num"].as_uint64();
                 rtrx.transaction_num = result.get_object()["trx_num"].as_uint64();
@@ -994,6 +1057,13 @@ public:
 
     uint32_t _tx_expiration_seconds = 30;
 
+    const fc::microseconds _cache_ttl = fc::seconds(SCORUM_BLOCK_INTERVAL);
+    const size_t _accounts_cache_max_size = 10000;
+
+    mutable std::map<std::string, std::pair<fc::time_point, account_api_obj>> _accounts_cache;
+    mutable dynamic_global_property_api_obj _dynamic_props;
+    mutable fc::time_point _dynamic_props_time;
+
     flat_map<std::string, operation> _prototype_ops;
 
     static_variant_map _operation_which_map = create_static_variant_map<operation>();
@@ -1054,15 +1124,15 @@ std::map<uint32_t, signed_block_api_obj> wallet_api::get_blocks_history(uint32_t
     return (*my->_remote_blockchain_history_api)->get_blocks_history(num, limit);
 }
 
-std::map<uint32_t, applied_operation> wallet_api::get_ops_in_block(uint32_t block_num,
-                                                                   applied_operation_type type_of_operation) const
+applied_operation_map_type wallet_api::get_ops_in_block(uint32_t block_num,
+                                                        applied_operation_type type_of_operation) const
 {
     my->use_remote_blockchain_history_api();
 
     return (*my->_remote_blockchain_history_api)->get_ops_in_block(block_num, type_of_operation);
 }
 
-std::map<uint32_t, applied_operation>
+applied_operation_map_type
 wallet_api::get_ops_history(uint32_t from_op, uint32_t limit, applied_operation_type type_of_operation) const
 {
     my->use_remote_blockchain_history_api();
@@ -1073,7 +1143,6 @@ wallet_api::get_ops_history(uint32_t from_op, uint32_t limit, applied_operation_
 std::vector<account_api_obj> wallet_api::list_my_accounts()
 {
     FC_ASSERT(!is_locked(), "Wallet must be unlocked to list accounts");
-    std::vector<account_api_obj> result;
 
     my->use_remote_account_by_key_api();
 
@@ -1089,11 +1158,7 @@ std::vector<account_api_obj> wallet_api::list_my_accounts()
         for (const auto& name : item)
             names.insert(name);
 
-    result.reserve(names.size());
-    for (const auto& name : names)
-        result.emplace_back(get_account(name));
-
-    return result;
+    return my->get_accounts(std::vector<std::string>(names.begin(), names.end()));
 }
 
 std::set<std::string> wallet_api::list_accounts(const std::string& lowerbound, uint32_t limit)
@@ -1536,7 +1601,7 @@ annotated_signed_transaction wallet_api::update_account_auth_key(const std::stri
 {
     FC_ASSERT(!is_locked());
 
-    auto accounts = my->_remote_db->get_accounts({ account_name });
+    auto accounts = my->get_accounts({ account_name });
     FC_ASSERT(accounts.size() == 1, "Account does not exist");
     FC_ASSERT(account_name == accounts[0].name, "Account name doesn't match?");
 
@@ -1607,7 +1672,7 @@ annotated_signed_transaction wallet_api::update_account_auth_account(const std::
 {
     FC_ASSERT(!is_locked());
 
-    auto accounts = my->_remote_db->get_accounts({ account_name });
+    auto accounts = my->get_accounts({ account_name });
     FC_ASSERT(accounts.size() == 1, "Account does not exist");
     FC_ASSERT(account_name == accounts[0].name, "Account name doesn't match?");
 
@@ -1677,7 +1742,7 @@ annotated_signed_transaction wallet_api::update_account_auth_threshold(const std
 {
     FC_ASSERT(!is_locked());
 
-    auto accounts = my->_remote_db->get_accounts({ account_name });
+    auto accounts = my->get_accounts({ account_name });
     FC_ASSERT(accounts.size() == 1, "Account does not exist");
     FC_ASSERT(account_name == accounts[0].name, "Account name doesn't match?");
     FC_ASSERT(threshold != 0, "Authority is implicitly satisfied");
@@ -1739,7 +1804,7 @@ wallet_api::update_account_meta(const std::string& account_name, const std::stri
 {
     FC_ASSERT(!is_locked());
 
-    auto accounts = my->_remote_db->get_accounts({ account_name });
+    auto accounts = my->get_accounts({ account_name });
     FC_ASSERT(accounts.size() == 1, "Account does not exist");
     FC_ASSERT(account_name == accounts[0].name, "Account name doesn't match?");
 
@@ -1760,7 +1825,7 @@ wallet_api::update_account_memo_key(const std::string& account_name, const publi
 {
     FC_ASSERT(!is_locked());
 
-    auto accounts = my->_remote_db->get_accounts({ account_name });
+    auto accounts = my->get_accounts({ account_name });
     FC_ASSERT(accounts.size() == 1, "Account does not exist");
     FC_ASSERT(account_name == accounts[0].name, "Account name doesn't match?");
 
@@ -1783,7 +1848,7 @@ annotated_signed_transaction wallet_api::delegate_scorumpower(const std::string&
 {
     FC_ASSERT(!is_locked());
 
-    auto accounts = my->_remote_db->get_accounts({ delegator, delegatee });
+    auto accounts = my->get_accounts({ delegator, delegatee });
     FC_ASSERT(accounts.size() == 2, "One or more of the accounts specified do not exist.");
     FC_ASSERT(delegator == accounts[0].name, "Delegator account is not right?");
     FC_ASSERT(delegatee == accounts[1].name, "Delegator account is not right?");
@@ -2012,6 +2077,13 @@ annotated_signed_transaction wallet_api::transfer(
     try
     {
         FC_ASSERT(!is_locked());
+
+        if (!memo.empty() && memo[0] == '#')
+        {
+            // fetch both memo keys at once, get_encrypted_memo takes them from the cache
+            my->get_accounts({ from, to });
+        }
+
         check_memo(memo, get_account(from));
         transfer_operation op;
         op.from = from;
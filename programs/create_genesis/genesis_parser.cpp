@@ -3,10 +3,12 @@
 #include <boost/filesystem/fstream.hpp>
 #include <boost/preprocessor/stringize.hpp>
 #include <sstream>
+#include <algorithm>
 #include <iostream>
 #include <vector>
 
 #include <scorum/chain/genesis/genesis_state.hpp>
+#include <scorum/chain/genesis/genesis_binary.hpp>
 
 #include <fc/io/json.hpp>
 
@@ -39,6 +41,12 @@ void load(const std::string& path, genesis_state_type& genesis)
 
     ilog("Loading ${file}.", ("file", path_to_load.string()));
 
+    if (scorum::chain::is_binary_genesis(path_to_load))
+    {
+        scorum::chain::load_binary_genesis(path_to_load, genesis);
+        return;
+    }
+
     boost::filesystem::ifstream fl;
     fl.open(path_to_load.string(), std::ios::in);
 
@@ -121,6 +129,30 @@ void save_to_file(genesis_state_type& genesis, const std::string& path, bool pre
     fl.close();
 }
 
+void save_to_binary_file(genesis_state_type& genesis, const std::string& path, bool pretty_print)
+{
+    // node computes chain id as hash of genesis file content, binary genesis gets the id of the json one
+    std::string output_json;
+    save_to_string(genesis, output_json, pretty_print);
+    genesis.initial_chain_id = fc::sha256::hash(output_json);
+
+    boost::filesystem::path path_to_save(path);
+
+    path_to_save.normalize();
+
+    ilog("Saving ${file}, chain id ${id}.", ("file", path_to_save.string())("id", genesis.initial_chain_id));
+
+    scorum::chain::save_binary_genesis(path_to_save, genesis);
+}
+
+void sort_accounts(genesis_state_type& genesis)
+{
+    std::sort(genesis.accounts.begin(), genesis.accounts.end(),
+              [](const genesis_state_type::account_type& lhs, const genesis_state_type::account_type& rhs) {
+                  return lhs.name < rhs.name;
+              });
+}
+
 void print(genesis_state_type& genesis, bool pretty_print)
 {
     std::string output_json;
@@ -25,11 +25,13 @@ int main(int argc, char** argv)
                 ("help,h", "Print this help message and exit.")
                 ("version,v", "Print version number and exit.")
                 ("import-json,i",     bpo::value<std::string>(), "Path for Json data file to parse.")
-                ("input-genesis-json,g",     bpo::value<std::string>(), "Path for Json genesis file to concatenate with result.")
+                ("input-genesis-json,g",     bpo::value<std::string>(), "Path for Json (or binary) genesis file to concatenate with result.")
                 ("test-resut-genesis,t", "Test opening sandbox database by resulted genesis.")
                 ("shared-memory-reserved-size,m",  bpo::value<unsigned int>()->default_value(100), "Reserved disk size (Mb) for database test.")
                 ("suppress-output-json,s", "Do not print result Json genesis.")
                 ("pretty-print,p", "Human readable format for output Json.")
+                ("sort-accounts", "Sort genesis accounts by name to speed up the node initialization (changes chain id).")
+                ("output-genesis-binary,b", bpo::value<std::string>(), "Path for result binary genesis file.")
                 ("check-users,u", bpo::value< std::vector<std::string> >()-> multitoken()->composing(), "Users list that are checked in result genesis.")
                 ("output-genesis-json,o", bpo::value<std::string>(), "Path for result Json genesis file.");
         // clang-format on
@@ -74,6 +76,11 @@ int main(int argc, char** argv)
             FC_ASSERT(options.count("input-genesis-json"));
         }
 
+        if (options.count("sort-accounts"))
+        {
+            scorum::util::sort_accounts(genesis);
+        }
+
         if (options.count("test-resut-genesis"))
         {
             unsigned int shared_mem_mb_size = options.at("shared-memory-reserved-size").as<unsigned int>();
@@ -81,7 +88,7 @@ int main(int argc, char** argv)
         }
         else
         {
-            FC_ASSERT(!options.count("suppress-output-json"));
+            FC_ASSERT(!options.count("suppress-output-json") || options.count("output-genesis-binary"));
         }
 
         if (options.count("check-users") > 0)
@@ -102,6 +109,12 @@ int main(int argc, char** argv)
             scorum::util::check_users(genesis, users);
         }
 
+        if (options.count("output-genesis-binary"))
+        {
+            scorum::util::save_to_binary_file(genesis, options.at("output-genesis-binary").as<std::string>(),
+                                              options.count("pretty-print"));
+        }
+
         if (options.count("output-genesis-json"))
         {
             scorum::util::save_to_file(genesis, options.at("output-genesis-json").as<std::string>(),
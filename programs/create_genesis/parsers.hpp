@@ -27,6 +27,12 @@ void save_to_string(genesis_state_type&, std::string&, bool pretty_print);
 
 void save_to_file(genesis_state_type&, const std::string& path, bool pretty_print);
 
+// chain id is computed from the json which save_to_file would write with the same pretty_print
+void save_to_binary_file(genesis_state_type&, const std::string& path, bool pretty_print);
+
+// node creates accounts in genesis order, presorted accounts are inserted into indexes sequentially
+void sort_accounts(genesis_state_type&);
+
 void print(genesis_state_type&, bool pretty_print);
 }
 }
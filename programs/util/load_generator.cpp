@@ -0,0 +1,617 @@
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/program_options.hpp>
+
+#include <fc/filesystem.hpp>
+#include <fc/io/json.hpp>
+#include <fc/log/logger_config.hpp>
+#include <fc/network/http/websocket.hpp>
+#include <fc/rpc/websocket_api.hpp>
+#include <fc/smart_ref_impl.hpp>
+#include <fc/thread/thread.hpp>
+
+#include <graphene/utilities/key_conversion.hpp>
+#include <graphene/utilities/tempdir.hpp>
+
+#include <scorum/app/api.hpp>
+#include <scorum/app/database_api.hpp>
+#include <scorum/chain/database/database.hpp>
+#include <scorum/chain/genesis/genesis_state.hpp>
+#include <scorum/chain/schema/dynamic_global_property_object.hpp>
+#include <scorum/chain/services/dynamic_global_property.hpp>
+#include <scorum/protocol/scorum_operations.hpp>
+
+namespace bpo = boost::program_options;
+
+using namespace scorum::protocol;
+
+using scorum::chain::database;
+using scorum::chain::genesis_state_type;
+
+namespace {
+
+const share_value_type account_scr_amount = 1000000000000ll;
+const share_value_type account_sp_amount = 1000000000000ll;
+const std::string witness_name = "initdelegate";
+
+private_key_type key_by_name(const std::string& name)
+{
+    return private_key_type::regenerate(fc::sha256::hash(name));
+}
+
+struct load_account
+{
+    explicit load_account(const std::string& n)
+        : name(n)
+        , key(key_by_name(n))
+    {
+    }
+
+    std::string name;
+    private_key_type key;
+
+    uint32_t delegations = 0;
+    fc::time_point_sec last_post;
+    fc::time_point_sec last_vote;
+};
+
+/// the chain state which is required to build and sign transaction
+struct head_state
+{
+    chain_id_type chain_id;
+    block_id_type head_block_id;
+    fc::time_point_sec time;
+    asset account_creation_fee;
+};
+
+enum operation_kind
+{
+    op_transfer = 0,
+    op_vote,
+    op_comment,
+    op_delegate,
+    op_account_create,
+
+    op_kinds_count
+};
+
+const char* operation_kind_names[op_kinds_count] = { "transfer", "vote", "comment", "delegate", "account_create" };
+
+/**
+ * Builds a reproducible sequence of signed transactions with one operation each. Every account is used round robin,
+ * the operation kind is chosen randomly according to the weights. If the chosen operation can not be applied
+ * by the account at the moment (comment interval, nothing to vote for, etc.) the transfer is made instead.
+ */
+class workload
+{
+public:
+    workload(uint32_t accounts_count, const std::vector<uint32_t>& weights, uint32_t seed)
+        : _rnd(seed)
+        , _kinds(weights.begin(), weights.end())
+        , _run_id(fc::time_point::now().sec_since_epoch() % 100000)
+    {
+        _accounts.reserve(accounts_count);
+        for (uint32_t i = 0; i < accounts_count; ++i)
+            _accounts.emplace_back("load" + std::to_string(i));
+    }
+
+    genesis_state_type make_genesis(fc::time_point_sec initial_timestamp) const
+    {
+        genesis_state_type genesis;
+
+        const load_account witness(witness_name);
+
+        genesis.accounts.push_back(
+            { witness.name, witness.key.get_public_key(), asset(account_scr_amount, SCORUM_SYMBOL) });
+        genesis.witness_candidates.push_back({ witness.name, witness.key.get_public_key() });
+        genesis.development_committee.push_back(witness.name);
+
+        for (const load_account& a : _accounts)
+        {
+            genesis.accounts.push_back({ a.name, a.key.get_public_key(), asset(account_scr_amount, SCORUM_SYMBOL) });
+            genesis.steemit_bounty_accounts.push_back({ a.name, asset(account_sp_amount, SP_SYMBOL) });
+        }
+
+        genesis.accounts_supply = asset(account_scr_amount * (share_value_type)genesis.accounts.size(), SCORUM_SYMBOL);
+        genesis.steemit_bounty_accounts_supply
+            = asset(account_sp_amount * (share_value_type)_accounts.size(), SP_SYMBOL);
+        genesis.rewards_supply = asset(account_scr_amount, SCORUM_SYMBOL);
+
+        genesis.total_supply = genesis.accounts_supply + genesis.rewards_supply
+            + asset(genesis.steemit_bounty_accounts_supply.amount, SCORUM_SYMBOL);
+
+        genesis.initial_timestamp = initial_timestamp;
+        genesis.initial_chain_id = fc::sha256::hash(fc::json::to_string(genesis));
+
+        return genesis;
+    }
+
+    signed_transaction make(const head_state& head)
+    {
+        const uint32_t idx = _next_account++ % _accounts.size();
+        load_account& actor = _accounts[idx];
+
+        signed_transaction tx;
+
+        uint32_t kind = _kinds(_rnd);
+        switch (kind)
+        {
+        case op_vote:
+            make_vote(tx, idx, head);
+            break;
+        case op_comment:
+            make_comment(tx, idx, head);
+            break;
+        case op_delegate:
+            make_delegate(tx, idx, head);
+            break;
+        case op_account_create:
+            make_account_create(tx, idx, head);
+            break;
+        default:
+            break;
+        }
+
+        if (tx.operations.empty())
+        {
+            kind = op_transfer;
+            make_transfer(tx, idx);
+        }
+
+        ++_counters[kind];
+
+        tx.set_expiration(head.time + SCORUM_MAX_TIME_UNTIL_EXPIRATION);
+        tx.set_reference_block(head.head_block_id);
+        tx.sign(actor.key, head.chain_id);
+
+        return tx;
+    }
+
+    /// amount of generated operations by operation type name
+    std::map<std::string, uint64_t> counters() const
+    {
+        std::map<std::string, uint64_t> result;
+        for (uint32_t kind = 0; kind < op_kinds_count; ++kind)
+            result[operation_kind_names[kind]] = _counters[kind];
+        return result;
+    }
+
+private:
+    void make_transfer(signed_transaction& tx, uint32_t idx)
+    {
+        transfer_operation op;
+        op.from = _accounts[idx].name;
+        op.to = _accounts[(idx + 1) % _accounts.size()].name;
+        op.amount = asset(1, SCORUM_SYMBOL);
+        op.memo = std::to_string(_next_account);
+
+        tx.operations.push_back(op);
+    }
+
+    void make_comment(signed_transaction& tx, uint32_t idx, const head_state& head)
+    {
+        load_account& actor = _accounts[idx];
+        if (actor.last_post != fc::time_point_sec() && head.time < actor.last_post + SCORUM_MIN_ROOT_COMMENT_INTERVAL)
+            return;
+
+        comment_operation op;
+        op.author = actor.name;
+        op.permlink = "load-" + std::to_string(_run_id) + "-" + std::to_string(_next_account);
+        op.parent_permlink = "load";
+        op.title = "Load generator post of " + actor.name;
+        op.body = std::string(512, 'x');
+        op.json_metadata = R"({"tags":["load"]})";
+
+        tx.operations.push_back(op);
+
+        actor.last_post = head.time;
+        _posts.emplace_back(idx, op.permlink);
+    }
+
+    void make_vote(signed_transaction& tx, uint32_t idx, const head_state& head)
+    {
+        load_account& actor = _accounts[idx];
+        if (_posts.empty() || head.time < actor.last_vote + SCORUM_MIN_VOTE_INTERVAL_SEC)
+            return;
+
+        // probe a few random posts to find one which is not voted by actor yet
+        std::uniform_int_distribution<size_t> dist(0, _posts.size() - 1);
+        for (uint32_t probe = 0; probe < 16; ++probe)
+        {
+            const auto& post = _posts[dist(_rnd)];
+            if (post.first == idx || !_votes.insert(std::make_pair(idx, post.second)).second)
+                continue;
+
+            vote_operation op;
+            op.voter = actor.name;
+            op.author = _accounts[post.first].name;
+            op.permlink = post.second;
+            op.weight = SCORUM_PERCENT(10);
+
+            tx.operations.push_back(op);
+
+            actor.last_vote = head.time;
+            return;
+        }
+    }
+
+    void make_delegate(signed_transaction& tx, uint32_t idx, const head_state& head)
+    {
+        load_account& actor = _accounts[idx];
+
+        // every next delegation to the same delegatee is an increase by the minimal allowed difference
+        const share_type min_delegation
+            = head.account_creation_fee.amount * SCORUM_MIN_DELEGATE_VESTING_SHARES_MODIFIER;
+        const share_type amount = min_delegation + head.account_creation_fee.amount * actor.delegations;
+        if (amount > account_sp_amount / 2)
+            return;
+
+        delegate_scorumpower_operation op;
+        op.delegator = actor.name;
+        op.delegatee = _accounts[(idx + 1) % _accounts.size()].name;
+        op.scorumpower = asset(amount, SP_SYMBOL);
+
+        tx.operations.push_back(op);
+
+        ++actor.delegations;
+    }
+
+    void make_account_create(signed_transaction& tx, uint32_t idx, const head_state& head)
+    {
+        const std::string name = "c" + std::to_string(_run_id) + "-" + std::to_string(_created++);
+        const public_key_type key = key_by_name(name).get_public_key();
+
+        account_create_operation op;
+        op.fee = head.account_creation_fee * SCORUM_CREATE_ACCOUNT_WITH_SCORUM_MODIFIER;
+        op.creator = _accounts[idx].name;
+        op.new_account_name = name;
+        op.owner = authority(1, key, 1);
+        op.active = authority(1, key, 1);
+        op.posting = authority(1, key, 1);
+        op.memo_key = key;
+
+        tx.operations.push_back(op);
+    }
+
+    std::mt19937 _rnd;
+    std::discrete_distribution<uint32_t> _kinds;
+    const uint32_t _run_id;
+
+    std::vector<load_account> _accounts;
+    std::vector<std::pair<uint32_t, std::string>> _posts;
+    std::set<std::pair<uint32_t, std::string>> _votes;
+    uint64_t _counters[op_kinds_count] = {};
+
+    uint32_t _next_account = 0;
+    uint64_t _created = 0;
+};
+
+class latency_stats
+{
+public:
+    void add(const fc::microseconds& value)
+    {
+        _samples.push_back(value.count());
+    }
+
+    size_t count() const
+    {
+        return _samples.size();
+    }
+
+    fc::mutable_variant_object report()
+    {
+        fc::mutable_variant_object result;
+
+        result("count", _samples.size());
+        if (_samples.empty())
+            return result;
+
+        std::sort(_samples.begin(), _samples.end());
+
+        int64_t total = 0;
+        for (int64_t s : _samples)
+            total += s;
+
+        result("avg_us", total / (int64_t)_samples.size());
+        result("p50_us", percentile(50));
+        result("p99_us", percentile(99));
+        result("max_us", _samples.back());
+
+        return result;
+    }
+
+private:
+    int64_t percentile(uint32_t p) const
+    {
+        return _samples[std::min(_samples.size() - 1, _samples.size() * p / 100)];
+    }
+
+    std::vector<int64_t> _samples;
+};
+
+struct load_report
+{
+    uint64_t accepted = 0;
+    uint64_t rejected = 0;
+    uint32_t blocks = 0;
+    fc::microseconds elapsed;
+
+    latency_stats admission;
+    latency_stats block_generation;
+
+    void reject(const fc::exception& e)
+    {
+        // log only a few first failures, they are usually all the same
+        if (rejected++ < 10)
+            elog("transaction is rejected: ${e}", ("e", e.to_string()));
+    }
+
+    fc::mutable_variant_object to_variant(const workload& load)
+    {
+        const double seconds = (double)elapsed.count() / 1000000;
+
+        fc::mutable_variant_object result;
+        result("accepted", accepted);
+        result("rejected", rejected);
+        result("blocks", blocks);
+        result("elapsed_sec", seconds);
+        result("tps", seconds > 0 ? (double)accepted / seconds : 0.);
+        result("trx_per_block", blocks > 0 ? (double)accepted / blocks : 0.);
+        result("operations", load.counters());
+        result("admission_latency", admission.report());
+        if (block_generation.count() > 0)
+            result("block_generation", block_generation.report());
+        return result;
+    }
+};
+
+fc::microseconds elapsed_since(const fc::time_point& start)
+{
+    return fc::time_point::now() - start;
+}
+
+/**
+ * Pushes transactions to the database opened in the same process. There is no pacing, the rate only sets the amount
+ * of transactions per block, so the elapsed time shows if the hardware can sustain this rate in real time.
+ */
+load_report run_in_process(workload& load, const bpo::variables_map& options)
+{
+    const uint32_t trx_per_block = options["rate"].as<uint32_t>() * SCORUM_BLOCK_INTERVAL;
+    const uint32_t blocks = options["blocks"].as<uint32_t>();
+    const uint64_t shared_file_size = options["shared-file-size-mb"].as<uint64_t>() * 1024 * 1024;
+
+    fc::temp_directory temp_dir(graphene::utilities::temp_directory_path());
+    const fc::path data_dir
+        = options.count("data-dir") ? fc::path(options["data-dir"].as<boost::filesystem::path>()) : temp_dir.path();
+
+    const genesis_state_type genesis
+        = load.make_genesis(scorum::protocol::detail::get_config().initial_date);
+
+    database db(database::opt_none);
+    db.open(data_dir, data_dir / "shared_memory", shared_file_size, chainbase::database::read_write, genesis);
+
+    const private_key_type witness_key = key_by_name(witness_name);
+
+    load_report report;
+
+    const fc::time_point start = fc::time_point::now();
+
+    for (uint32_t i = 0; i < blocks; ++i)
+    {
+        head_state head;
+        head.chain_id = db.get_chain_id();
+        head.head_block_id = db.head_block_id();
+        head.time = db.head_block_time();
+        head.account_creation_fee
+            = db.dynamic_global_property_service().get().median_chain_props.account_creation_fee;
+
+        for (uint32_t j = 0; j < trx_per_block; ++j)
+        {
+            signed_transaction tx = load.make(head);
+
+            const fc::time_point pushed = fc::time_point::now();
+            try
+            {
+                db.push_transaction(tx, database::skip_nothing);
+                report.admission.add(elapsed_since(pushed));
+                ++report.accepted;
+            }
+            catch (const fc::exception& e)
+            {
+                report.reject(e);
+            }
+        }
+
+        const fc::time_point generated = fc::time_point::now();
+        db.generate_block(db.get_slot_time(1), db.get_scheduled_witness(1), witness_key, database::skip_nothing);
+        report.block_generation.add(elapsed_since(generated));
+        ++report.blocks;
+    }
+
+    report.elapsed = elapsed_since(start);
+
+    db.close();
+
+    return report;
+}
+
+/**
+ * Broadcasts transactions to the running node with the rate limited by wall clock. The node should be started
+ * with the genesis produced by --genesis-out and with initdelegate as the producing witness.
+ */
+load_report run_websocket(workload& load, const bpo::variables_map& options)
+{
+    using namespace scorum::app;
+
+    const uint32_t rate = options["rate"].as<uint32_t>();
+    const fc::microseconds duration = fc::seconds(options["duration"].as<uint32_t>());
+
+    fc::http::websocket_client client;
+    auto con = client.connect(options["server-rpc-endpoint"].as<std::string>());
+    auto apic = std::make_shared<fc::rpc::websocket_api_connection>(*con);
+
+    auto remote_api = apic->get_remote_api<login_api>(1);
+    FC_ASSERT(remote_api->login("", ""));
+
+    auto remote_db = remote_api->get_api_by_name("database_api")->as<database_api>();
+    auto remote_broadcast = remote_api->get_api_by_name("network_broadcast_api")->as<network_broadcast_api>();
+
+    head_state head;
+    head.chain_id = remote_db->get_chain_id();
+
+    auto refresh_head = [&]() {
+        auto props = remote_db->get_dynamic_global_properties();
+        head.head_block_id = props.head_block_id;
+        head.time = props.time;
+        head.account_creation_fee = props.median_chain_props.account_creation_fee;
+        return props.head_block_number;
+    };
+
+    const uint32_t first_block = refresh_head();
+
+    load_report report;
+
+    const fc::time_point start = fc::time_point::now();
+    fc::time_point next_refresh = start;
+    uint64_t sent = 0;
+
+    while (elapsed_since(start) < duration)
+    {
+        if (fc::time_point::now() >= next_refresh)
+        {
+            refresh_head();
+            next_refresh = fc::time_point::now() + fc::seconds(1);
+        }
+
+        // keep the pace of the requested rate, the delay is not accumulated if node responds slower
+        const fc::time_point due = start + fc::microseconds(sent * 1000000 / rate);
+        if (fc::time_point::now() < due)
+            fc::usleep(due - fc::time_point::now());
+
+        signed_transaction tx = load.make(head);
+        ++sent;
+
+        const fc::time_point pushed = fc::time_point::now();
+        try
+        {
+            remote_broadcast->broadcast_transaction(tx);
+            report.admission.add(elapsed_since(pushed));
+            ++report.accepted;
+        }
+        catch (const fc::exception& e)
+        {
+            report.reject(e);
+        }
+    }
+
+    report.elapsed = elapsed_since(start);
+    report.blocks = refresh_head() - first_block;
+
+    return report;
+}
+
+std::vector<uint32_t> parse_mix(const std::string& mix)
+{
+    std::vector<uint32_t> weights(op_kinds_count, 0);
+
+    std::vector<std::string> items;
+    boost::split(items, mix, boost::is_any_of(","));
+
+    for (const std::string& item : items)
+    {
+        std::vector<std::string> pair;
+        boost::split(pair, item, boost::is_any_of(":"));
+        FC_ASSERT(pair.size() == 2, "Invalid mix item '${i}', expected <operation>:<weight>.", ("i", item));
+
+        const std::string name = boost::trim_copy(pair[0]);
+
+        auto it = std::find(std::begin(operation_kind_names), std::end(operation_kind_names), name);
+        FC_ASSERT(it != std::end(operation_kind_names), "Unknown operation '${o}'.", ("o", name));
+
+        weights[it - std::begin(operation_kind_names)] = boost::lexical_cast<uint32_t>(boost::trim_copy(pair[1]));
+    }
+
+    FC_ASSERT(std::any_of(weights.begin(), weights.end(), [](uint32_t w) { return w > 0; }),
+              "At least one operation should have non zero weight.");
+
+    return weights;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        bpo::options_description opts("Synthetic transaction load generator");
+
+        // clang-format off
+        opts.add_options()
+            ("help,h", "Print this help message and exit.")
+            ("mode", bpo::value<std::string>()->default_value("in-process"), "'in-process' to push transactions to the own database, 'websocket' to broadcast them to the running node.")
+            ("accounts", bpo::value<uint32_t>()->default_value(5000), "Amount of funded accounts in genesis.")
+            ("rate", bpo::value<uint32_t>()->default_value(100), "Target transactions per second.")
+            ("mix", bpo::value<std::string>()->default_value("transfer:50,vote:25,comment:10,delegate:10,account_create:5"), "Weights of generated operations.")
+            ("seed", bpo::value<uint32_t>()->default_value(1), "Seed of the operation mix random generator.")
+            ("blocks", bpo::value<uint32_t>()->default_value(100), "Amount of blocks to generate in 'in-process' mode.")
+            ("data-dir", bpo::value<boost::filesystem::path>(), "Database directory in 'in-process' mode, temporary directory is used by default.")
+            ("shared-file-size-mb", bpo::value<uint64_t>()->default_value(4096), "Size of the shared memory file in 'in-process' mode.")
+            ("duration", bpo::value<uint32_t>()->default_value(60), "Duration in seconds in 'websocket' mode.")
+            ("server-rpc-endpoint", bpo::value<std::string>()->default_value("ws://127.0.0.1:8090"), "Node websocket RPC endpoint in 'websocket' mode.")
+            ("genesis-out", bpo::value<boost::filesystem::path>(), "Write genesis with load accounts to the file and exit.")
+            ;
+        // clang-format on
+
+        bpo::variables_map options;
+        bpo::store(bpo::parse_command_line(argc, argv, opts), options);
+        bpo::notify(options);
+
+        if (options.count("help"))
+        {
+            std::cout << opts << "\n";
+            return 0;
+        }
+
+        fc::configure_logging(fc::logging_config::default_config());
+
+        workload load(options["accounts"].as<uint32_t>(), parse_mix(options["mix"].as<std::string>()),
+                      options["seed"].as<uint32_t>());
+
+        if (options.count("genesis-out"))
+        {
+            const fc::path path = options["genesis-out"].as<boost::filesystem::path>();
+
+            fc::json::save_to_file(load.make_genesis(fc::time_point_sec(fc::time_point::now())), path);
+
+            std::cout << "genesis is saved to " << path.generic_string() << "\n"
+                      << "start node with: --genesis-json " << path.generic_string()
+                      << " --enable-stale-production --witness \"\\\"" << witness_name << "\\\"\""
+                      << " --private-key " << graphene::utilities::key_to_wif(key_by_name(witness_name)) << "\n";
+            return 0;
+        }
+
+        const std::string mode = options["mode"].as<std::string>();
+        FC_ASSERT(mode == "in-process" || mode == "websocket", "Unknown mode '${m}'.", ("m", mode));
+        FC_ASSERT(options["rate"].as<uint32_t>() > 0, "Rate should be positive.");
+
+        load_report report = mode == "in-process" ? run_in_process(load, options) : run_websocket(load, options);
+
+        std::cout << fc::json::to_pretty_string(report.to_variant(load)) << std::endl;
+    }
+    catch (const fc::exception& e)
+    {
+        std::cerr << e.to_detail_string() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
@@ -47,6 +47,7 @@ int main(int argc, char** argv, char** envp)
 
     schemas.push_back(get_schema_for_type<scorum::chain::account_object>());
     schemas.push_back(get_schema_for_type<scorum::chain::comment_object>());
+    schemas.push_back(get_schema_for_type<scorum::chain::comment_content_object>());
     add_dependent_schemas(schemas);
 
     for (const std::shared_ptr<abstract_schema>& s : schemas)
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <boost/preprocessor/cat.hpp>
+
+#include <fc/reflect/reflect.hpp>
+
+namespace scorum {
+namespace bench {
+
+struct benchmark_result
+{
+    std::string name;
+    uint64_t iterations = 0;
+    uint64_t items = 0;
+    uint64_t elapsed_ns = 0;
+    double ns_per_item = 0;
+    double items_per_sec = 0;
+};
+
+/**
+ * Passed to every benchmark body. Only the code wrapped into measure() is timed,
+ * so a benchmark is free to prepare its fixture (databases, blocks, logs) before.
+ */
+class benchmark_context
+{
+public:
+    explicit benchmark_context(uint64_t iterations)
+        : _iterations(iterations)
+    {
+    }
+
+    uint64_t iterations() const
+    {
+        return _iterations;
+    }
+
+    template <typename Lambda> void measure(Lambda&& body)
+    {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        auto stop = std::chrono::steady_clock::now();
+
+        _elapsed += std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start);
+    }
+
+    /// by default every iteration is counted as one processed item
+    void set_items_processed(uint64_t items)
+    {
+        _items = items;
+    }
+
+    benchmark_result result(const std::string& name) const;
+
+private:
+    uint64_t _iterations = 0;
+    uint64_t _items = 0;
+    std::chrono::nanoseconds _elapsed = std::chrono::nanoseconds::zero();
+};
+
+using benchmark_fn = std::function<void(benchmark_context&)>;
+
+struct benchmark_info
+{
+    std::string name;
+    uint64_t iterations;
+    benchmark_fn fn;
+};
+
+std::vector<benchmark_info>& registry();
+
+struct benchmark_registrar
+{
+    benchmark_registrar(const std::string& name, uint64_t iterations, benchmark_fn fn)
+    {
+        registry().push_back({ name, iterations, fn });
+    }
+};
+
+} // namespace bench
+} // namespace scorum
+
+#define SCORUM_BENCHMARK_FN(name) BOOST_PP_CAT(name, _benchmark)
+
+/**
+ *  Registers benchmark body with default iteration count.
+ *  Usage:
+ *
+ *  SCORUM_BENCHMARK(chainbase_create, 100000)
+ *  {
+ *      ctx.measure([&]() { ... });
+ *  }
+ */
+#define SCORUM_BENCHMARK(name, iterations)                                                                             \
+    static void SCORUM_BENCHMARK_FN(name)(scorum::bench::benchmark_context&);                                          \
+    static scorum::bench::benchmark_registrar BOOST_PP_CAT(name, _registrar)(#name, iterations,                        \
+                                                                             &SCORUM_BENCHMARK_FN(name));              \
+    static void SCORUM_BENCHMARK_FN(name)(scorum::bench::benchmark_context & ctx)
+
+FC_REFLECT(scorum::bench::benchmark_result, (name)(iterations)(items)(elapsed_ns)(ns_per_item)(items_per_sec))
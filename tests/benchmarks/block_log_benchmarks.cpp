@@ -0,0 +1,144 @@
+#include <exception>
+#include <random>
+#include <thread>
+
+#include <fc/filesystem.hpp>
+#include <fc/smart_ref_impl.hpp>
+
+#include <graphene/utilities/tempdir.hpp>
+
+#include <scorum/chain/block_log.hpp>
+#include <scorum/protocol/scorum_operations.hpp>
+
+#include "benchmark.hpp"
+
+namespace block_log_benchmarks {
+
+using namespace scorum::chain;
+using namespace scorum::protocol;
+
+using scorum::bench::benchmark_context;
+
+// block_log does not validate content, so blocks are filled with plain unsigned transfers to get realistic sizes
+static const uint32_t transactions_per_block = 50;
+
+class block_log_fixture
+{
+public:
+    explicit block_log_fixture(uint32_t blocks_count)
+        : _dir(graphene::utilities::temp_directory_path())
+    {
+        log.open(_dir.path() / "block_log");
+
+        block_id_type previous;
+        for (uint32_t num = 1; num <= blocks_count; ++num)
+        {
+            signed_block b;
+            b.previous = previous;
+            b.timestamp = fc::time_point_sec(num * SCORUM_BLOCK_INTERVAL);
+            b.witness = "initdelegate";
+
+            for (uint32_t i = 0; i < transactions_per_block; ++i)
+            {
+                transfer_operation op;
+                op.from = "alice";
+                op.to = "bob";
+                op.amount = asset(num * transactions_per_block + i, SCORUM_SYMBOL);
+                op.memo = "memo";
+
+                signed_transaction tx;
+                tx.operations.push_back(op);
+                b.transactions.push_back(tx);
+            }
+
+            log.append(b);
+            previous = b.id();
+        }
+
+        log.flush();
+    }
+
+    block_log log;
+
+private:
+    fc::temp_directory _dir;
+};
+
+SCORUM_BENCHMARK(block_log_sequential_read, 20000)
+{
+    block_log_fixture fixture((uint32_t)ctx.iterations());
+
+    uint64_t read = 0;
+    ctx.measure([&]() {
+        auto itr = fixture.log.read_block(0);
+        ++read;
+        while (itr.first.block_num() < ctx.iterations())
+        {
+            itr = fixture.log.read_block(itr.second);
+            ++read;
+        }
+    });
+
+    FC_ASSERT(read == ctx.iterations());
+}
+
+SCORUM_BENCHMARK(block_log_random_read, 20000)
+{
+    block_log_fixture fixture((uint32_t)ctx.iterations());
+
+    std::mt19937 rnd(ctx.iterations());
+    std::uniform_int_distribution<uint32_t> dist(1, (uint32_t)ctx.iterations());
+
+    std::vector<uint32_t> nums(ctx.iterations());
+    for (auto& num : nums)
+        num = dist(rnd);
+
+    ctx.measure([&]() {
+        for (uint32_t num : nums)
+            FC_ASSERT(fixture.log.read_block_by_num(num).valid());
+    });
+}
+
+SCORUM_BENCHMARK(block_log_concurrent_random_read, 20000)
+{
+    static const uint32_t threads_count = 4;
+
+    block_log_fixture fixture((uint32_t)ctx.iterations());
+
+    std::mt19937 rnd(ctx.iterations());
+    std::uniform_int_distribution<uint32_t> dist(1, (uint32_t)ctx.iterations());
+
+    std::vector<uint32_t> nums(ctx.iterations());
+    for (auto& num : nums)
+        num = dist(rnd);
+
+    ctx.measure([&]() {
+        std::vector<std::thread> threads;
+        std::vector<std::exception_ptr> errors(threads_count);
+        for (uint32_t t = 0; t < threads_count; ++t)
+        {
+            threads.emplace_back([&, t]() {
+                // an exception escaping the thread terminates the process, so it is reported after join
+                try
+                {
+                    for (size_t i = t; i < nums.size(); i += threads_count)
+                        FC_ASSERT(fixture.log.read_block_by_num(nums[i]).valid());
+                }
+                catch (...)
+                {
+                    errors[t] = std::current_exception();
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        for (const auto& error : errors)
+        {
+            if (error)
+                std::rethrow_exception(error);
+        }
+    });
+}
+}
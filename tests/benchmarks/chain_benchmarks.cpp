@@ -0,0 +1,99 @@
+#include <algorithm>
+
+#include <fc/filesystem.hpp>
+
+#include <graphene/utilities/tempdir.hpp>
+
+#include "benchmark.hpp"
+#include "synthetic_chain.hpp"
+
+namespace chain_benchmarks {
+
+using namespace scorum::bench;
+
+static const uint32_t accounts_count = 2000;
+static const uint32_t transactions_per_block = 100;
+
+/**
+ * Blocks are produced by synthetic_chain and then pushed to the fresh replica database,
+ * so only the validation and evaluation of the received block is measured.
+ */
+static void apply_blocks(benchmark_context& ctx, uint32_t workload)
+{
+    fc::temp_directory dir(graphene::utilities::temp_directory_path());
+
+    // every account posts only once, so the pure comments workload needs an account per transaction
+    uint32_t accounts = accounts_count;
+    if (workload == workload_comments)
+        accounts = std::max<uint32_t>(accounts, (uint32_t)ctx.iterations() * transactions_per_block);
+
+    synthetic_chain chain(accounts, dir.path() / "producer");
+
+    std::vector<signed_block> prologue;
+    if (workload & workload_votes)
+        prologue = chain.generate_posts(transactions_per_block);
+
+    auto blocks = chain.generate((uint32_t)ctx.iterations(), transactions_per_block, workload);
+
+    chain.close();
+
+    auto replica = chain.open_replica(dir.path() / "replica");
+
+    for (const auto& b : prologue)
+        replica->push_block(b, database::skip_nothing);
+
+    uint64_t transactions = 0;
+    ctx.measure([&]() {
+        for (const auto& b : blocks)
+        {
+            replica->push_block(b, database::skip_nothing);
+            transactions += b.transactions.size();
+        }
+    });
+
+    ctx.set_items_processed(transactions);
+
+    replica->close();
+}
+
+SCORUM_BENCHMARK(apply_block_transfers, 200)
+{
+    apply_blocks(ctx, workload_transfers);
+}
+
+SCORUM_BENCHMARK(apply_block_comments, 20)
+{
+    apply_blocks(ctx, workload_comments);
+}
+
+SCORUM_BENCHMARK(apply_block_votes, 200)
+{
+    apply_blocks(ctx, workload_votes);
+}
+
+SCORUM_BENCHMARK(apply_block_mixed, 200)
+{
+    apply_blocks(ctx, workload_mixed);
+}
+
+SCORUM_BENCHMARK(reindex, 500)
+{
+    fc::temp_directory dir(graphene::utilities::temp_directory_path());
+
+    synthetic_chain chain(accounts_count, dir.path());
+
+    chain.generate((uint32_t)ctx.iterations(), transactions_per_block, workload_mixed);
+
+    chain.close();
+
+    database db(database::opt_none);
+
+    ctx.measure([&]() {
+        db.reindex(chain.data_dir(), dir.path() / "reindex", BENCH_CHAIN_SHARED_MEM_SIZE, chain.genesis());
+    });
+
+    ctx.set_items_processed(db.head_block_num());
+
+    db.close();
+}
+}
@@ -0,0 +1,219 @@
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/member.hpp>
+
+#include <fc/filesystem.hpp>
+
+#include <graphene/utilities/tempdir.hpp>
+
+#include <chainbase/chainbase.hpp>
+
+#include "benchmark.hpp"
+
+using namespace boost::multi_index;
+
+namespace chainbase_benchmarks {
+
+struct bench_object : public chainbase::object<0, bench_object>
+{
+    CHAINBASE_DEFAULT_CONSTRUCTOR(bench_object)
+
+    id_type id;
+    int64_t key = 0;
+    int64_t value = 0;
+};
+
+struct by_id;
+struct by_key;
+
+typedef fc::shared_multi_index_container<bench_object,
+                                         indexed_by<ordered_unique<tag<by_id>,
+                                                                   member<bench_object,
+                                                                          bench_object::id_type,
+                                                                          &bench_object::id>>,
+                                                    ordered_non_unique<tag<by_key>,
+                                                                       member<bench_object,
+                                                                              int64_t,
+                                                                              &bench_object::key>>>>
+    bench_index;
+
+} // namespace chainbase_benchmarks
+
+CHAINBASE_SET_INDEX_TYPE(chainbase_benchmarks::bench_object, chainbase_benchmarks::bench_index)
+
+namespace chainbase_benchmarks {
+
+using scorum::bench::benchmark_context;
+
+#define BENCH_SHARED_MEM_SIZE (1024ull * 1024 * 1024)
+
+class bench_database : public chainbase::database
+{
+public:
+    bench_database()
+        : _dir(graphene::utilities::temp_directory_path())
+    {
+        open(_dir.path(), chainbase::database::read_write, BENCH_SHARED_MEM_SIZE);
+        add_index<bench_index>();
+    }
+
+    ~bench_database()
+    {
+        close();
+    }
+
+    void undo()
+    {
+        for_each_index([&](chainbase::abstract_generic_index_i& item) { item.undo(); });
+    }
+
+    void squash()
+    {
+        for_each_index([&](chainbase::abstract_generic_index_i& item) { item.squash(); });
+    }
+
+    void fill(uint64_t count)
+    {
+        for (uint64_t i = 0; i < count; ++i)
+            create<bench_object>([&](bench_object& o) { o.key = (int64_t)i; });
+    }
+
+private:
+    fc::temp_directory _dir;
+};
+
+SCORUM_BENCHMARK(chainbase_create, 200000)
+{
+    bench_database db;
+
+    ctx.measure([&]() {
+        for (uint64_t i = 0; i < ctx.iterations(); ++i)
+            db.create<bench_object>([&](bench_object& o) { o.key = (int64_t)i; });
+    });
+}
+
+SCORUM_BENCHMARK(chainbase_create_in_undo_session, 200000)
+{
+    bench_database db;
+
+    auto session = db.start_undo_session();
+
+    ctx.measure([&]() {
+        for (uint64_t i = 0; i < ctx.iterations(); ++i)
+            db.create<bench_object>([&](bench_object& o) { o.key = (int64_t)i; });
+    });
+
+    session->push();
+}
+
+SCORUM_BENCHMARK(chainbase_modify, 200000)
+{
+    bench_database db;
+    db.fill(ctx.iterations());
+
+    ctx.measure([&]() {
+        for (uint64_t i = 0; i < ctx.iterations(); ++i)
+            db.modify(db.get<bench_object>(i), [&](bench_object& o) { o.value++; });
+    });
+}
+
+SCORUM_BENCHMARK(chainbase_modify_in_undo_session, 200000)
+{
+    bench_database db;
+    db.fill(ctx.iterations());
+
+    auto session = db.start_undo_session();
+
+    ctx.measure([&]() {
+        for (uint64_t i = 0; i < ctx.iterations(); ++i)
+            db.modify(db.get<bench_object>(i), [&](bench_object& o) { o.value++; });
+    });
+
+    session->push();
+}
+
+SCORUM_BENCHMARK(chainbase_remove, 200000)
+{
+    bench_database db;
+    db.fill(ctx.iterations());
+
+    ctx.measure([&]() {
+        for (uint64_t i = 0; i < ctx.iterations(); ++i)
+            db.remove(db.get<bench_object>(i));
+    });
+}
+
+SCORUM_BENCHMARK(chainbase_remove_in_undo_session, 200000)
+{
+    bench_database db;
+    db.fill(ctx.iterations());
+
+    auto session = db.start_undo_session();
+
+    ctx.measure([&]() {
+        for (uint64_t i = 0; i < ctx.iterations(); ++i)
+            db.remove(db.get<bench_object>(i));
+    });
+
+    session->push();
+}
+
+SCORUM_BENCHMARK(chainbase_get_by_id, 1000000)
+{
+    static const uint64_t objects_count = 100000;
+
+    bench_database db;
+    db.fill(objects_count);
+
+    int64_t sum = 0;
+    ctx.measure([&]() {
+        for (uint64_t i = 0; i < ctx.iterations(); ++i)
+            sum += db.get<bench_object>(i % objects_count).key;
+    });
+
+    FC_ASSERT(sum >= 0);
+}
+
+// every iteration is a session with a few mutations which is squashed into the parent one,
+// this is how pending transactions are merged into the pending block session
+SCORUM_BENCHMARK(chainbase_squash, 50000)
+{
+    static const uint64_t objects_count = 1000;
+
+    bench_database db;
+    db.fill(objects_count);
+
+    auto block_session = db.start_undo_session();
+
+    ctx.measure([&]() {
+        for (uint64_t i = 0; i < ctx.iterations(); ++i)
+        {
+            auto trx_session = db.start_undo_session();
+            db.create<bench_object>([&](bench_object& o) { o.key = (int64_t)i; });
+            db.modify(db.get<bench_object>(i % objects_count), [&](bench_object& o) { o.value++; });
+            db.squash();
+            trx_session->push();
+        }
+    });
+
+    block_session->push();
+}
+
+SCORUM_BENCHMARK(chainbase_undo, 50000)
+{
+    static const uint64_t objects_count = 1000;
+
+    bench_database db;
+    db.fill(objects_count);
+
+    ctx.measure([&]() {
+        for (uint64_t i = 0; i < ctx.iterations(); ++i)
+        {
+            auto session = db.start_undo_session();
+            db.create<bench_object>([&](bench_object& o) { o.key = (int64_t)i; });
+            db.modify(db.get<bench_object>(i % objects_count), [&](bench_object& o) { o.value++; });
+            // session destructor rolls back changes
+        }
+    });
+}
+}
@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+
+"""
+Compares two JSON reports produced by the benchmarks executable.
+
+Usage: compare_reports.py baseline.json current.json [--threshold 10]
+
+Exits with non-zero code if any benchmark is slower than baseline by more than threshold percents.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        report = json.load(f)
+    return report, {b["name"]: b for b in report["benchmarks"]}
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare benchmark reports")
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=10.0, help="allowed slowdown in percents")
+    args = parser.parse_args()
+
+    baseline_report, baseline = load(args.baseline)
+    current_report, current = load(args.current)
+
+    print("%-36s %14s %14s %9s" % ("benchmark", "base ns/item", "curr ns/item", "diff"))
+
+    regressions = 0
+    for name, cur in sorted(current.items()):
+        base = baseline.get(name)
+        if base is None or not base["ns_per_item"]:
+            print("%-36s %14s %14.1f %9s" % (name, "-", cur["ns_per_item"], "new"))
+            continue
+
+        diff = (cur["ns_per_item"] - base["ns_per_item"]) * 100.0 / base["ns_per_item"]
+        mark = ""
+        if diff > args.threshold:
+            regressions += 1
+            mark = " <<"
+
+        print("%-36s %14.1f %14.1f %+8.1f%%%s" % (name, base["ns_per_item"], cur["ns_per_item"], diff, mark))
+
+    print("\nbaseline: %s, current: %s" % (baseline_report["revision"], current_report["revision"]))
+
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
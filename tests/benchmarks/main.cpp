@@ -0,0 +1,152 @@
+#include <cstdlib>
+#include <iostream>
+
+#include <boost/make_unique.hpp>
+#include <boost/program_options.hpp>
+
+#include <fc/filesystem.hpp>
+#include <fc/io/json.hpp>
+#include <fc/log/logger.hpp>
+#include <fc/log/logger_config.hpp>
+#include <fc/reflect/variant.hpp>
+#include <fc/time.hpp>
+
+#include <graphene/utilities/git_revision.hpp>
+
+#include <scorum/protocol/config.hpp>
+
+#include "benchmark.hpp"
+
+namespace scorum {
+namespace bench {
+
+benchmark_result benchmark_context::result(const std::string& name) const
+{
+    benchmark_result r;
+    r.name = name;
+    r.iterations = _iterations;
+    r.items = _items ? _items : _iterations;
+    r.elapsed_ns = (uint64_t)_elapsed.count();
+
+    if (r.items)
+        r.ns_per_item = double(r.elapsed_ns) / r.items;
+    if (r.elapsed_ns)
+        r.items_per_sec = double(r.items) * 1e9 / r.elapsed_ns;
+
+    return r;
+}
+
+std::vector<benchmark_info>& registry()
+{
+    static std::vector<benchmark_info> benchmarks;
+    return benchmarks;
+}
+
+} // namespace bench
+} // namespace scorum
+
+namespace bpo = boost::program_options;
+
+static void configure_logging()
+{
+    fc::logging_config log_conf;
+
+    log_conf.appenders.push_back(
+        fc::appender_config("stderr", "console", fc::mutable_variant_object()("stream", "std_error")));
+
+    fc::logger_config lg;
+    lg.name = "default";
+    lg.level = fc::log_level::error;
+    lg.appenders.push_back("stderr");
+    log_conf.loggers.push_back(lg);
+    fc::configure_logging(log_conf);
+}
+
+int main(int argc, char** argv)
+{
+    using namespace scorum::bench;
+
+    try
+    {
+        bpo::options_description opts("Scorum benchmarks");
+        // clang-format off
+        opts.add_options()
+            ("help,h", "Print this help message and exit.")
+            ("list,l", "List available benchmarks and exit.")
+            ("filter,f", bpo::value<std::string>()->default_value(""), "Run only benchmarks which names contain this substring.")
+            ("scale,s", bpo::value<double>()->default_value(1.0), "Multiplier for the default iteration count of every benchmark.")
+            ("output,o", bpo::value<std::string>(), "Write JSON report to the file instead of stdout.");
+        // clang-format on
+
+        bpo::variables_map options;
+        bpo::store(bpo::parse_command_line(argc, argv, opts), options);
+        bpo::notify(options);
+
+        if (options.count("help"))
+        {
+            std::cout << opts << std::endl;
+            return 0;
+        }
+
+        if (options.count("list"))
+        {
+            for (const auto& b : registry())
+                std::cout << b.name << std::endl;
+            return 0;
+        }
+
+        scorum::protocol::detail::override_config(
+            boost::make_unique<scorum::protocol::detail::config>(scorum::protocol::detail::config::test));
+
+        configure_logging();
+
+        const auto filter = options["filter"].as<std::string>();
+        const auto scale = options["scale"].as<double>();
+
+        std::vector<benchmark_result> results;
+
+        for (const auto& b : registry())
+        {
+            if (b.name.find(filter) == std::string::npos)
+                continue;
+
+            uint64_t iterations = std::max<uint64_t>(1, uint64_t(b.iterations * scale));
+
+            std::cerr << "running " << b.name << " (" << iterations << " iterations)" << std::endl;
+
+            benchmark_context ctx(iterations);
+            b.fn(ctx);
+
+            results.push_back(ctx.result(b.name));
+
+            std::cerr << "    " << results.back().ns_per_item << " ns/item, " << results.back().items_per_sec
+                      << " items/sec" << std::endl;
+        }
+
+        fc::mutable_variant_object report;
+        report("revision", graphene::utilities::git_revision_sha)(
+            "revision_time", fc::time_point_sec(graphene::utilities::git_revision_unix_timestamp))(
+            "run_time", fc::time_point_sec(fc::time_point::now()))("scale", scale)("benchmarks", results);
+
+        if (options.count("output"))
+        {
+            fc::json::save_to_file(fc::variant(report), fc::path(options["output"].as<std::string>()));
+        }
+        else
+        {
+            std::cout << fc::json::to_pretty_string(fc::variant(report)) << std::endl;
+        }
+    }
+    catch (const fc::exception& e)
+    {
+        std::cerr << e.to_detail_string() << std::endl;
+        return EXIT_FAILURE;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return 0;
+}
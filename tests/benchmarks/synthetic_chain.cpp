@@ -0,0 +1,196 @@
+#include <algorithm>
+
+#include <fc/smart_ref_impl.hpp>
+
+#include <scorum/protocol/scorum_operations.hpp>
+
+#include "defines.hpp"
+#include "genesis.hpp"
+#include "synthetic_chain.hpp"
+
+namespace scorum {
+namespace bench {
+
+using namespace scorum::protocol;
+
+namespace {
+const share_value_type account_scr_amount = 1000000000000ll;
+const share_value_type account_sp_amount = 1000000000000ll;
+}
+
+synthetic_chain::synthetic_chain(uint32_t accounts_count, const fc::path& dir)
+    : _dir(dir)
+    , _witness(TEST_INIT_DELEGATE_NAME)
+{
+    FC_ASSERT(accounts_count > 1, "At least two accounts are required.");
+
+    _witness.scorum(TEST_ACCOUNTS_INITIAL_SUPPLY);
+
+    Genesis genesis = Genesis::create()
+                          .rewards_supply(TEST_REWARD_INITIAL_SUPPLY)
+                          .dev_committee(_witness)
+                          .witnesses(_witness);
+
+    share_value_type scr_supply = TEST_ACCOUNTS_INITIAL_SUPPLY.amount.value;
+    share_value_type sp_supply = 0;
+
+    _accounts.reserve(accounts_count);
+    for (uint32_t i = 0; i < accounts_count; ++i)
+    {
+        _accounts.emplace_back("account" + std::to_string(i));
+
+        Actor& a = _accounts.back();
+        a.scorum(ASSET_SCR(account_scr_amount));
+        a.scorumpower(ASSET_SP(account_sp_amount));
+
+        genesis.account_create(a);
+        genesis.steemit_bounty_account_create(a);
+
+        scr_supply += account_scr_amount;
+        sp_supply += account_sp_amount;
+    }
+
+    _genesis = genesis.accounts_supply(ASSET_SCR(scr_supply))
+                   .steemit_bounty_accounts_supply(ASSET_SP(sp_supply))
+                   .generate();
+
+    _posts.reserve(accounts_count);
+
+    _db = open_replica(_dir);
+}
+
+synthetic_chain::~synthetic_chain()
+{
+    close();
+}
+
+std::unique_ptr<database> synthetic_chain::open_replica(const fc::path& dir) const
+{
+    std::unique_ptr<database> db(new database(database::opt_none));
+    db->open(dir, dir / "shared_memory", BENCH_CHAIN_SHARED_MEM_SIZE, chainbase::database::read_write, _genesis);
+    return db;
+}
+
+std::vector<signed_block> synthetic_chain::generate_posts(uint32_t trx_per_block)
+{
+    std::vector<signed_block> blocks;
+
+    uint32_t seq = 0;
+    while (_posts.size() < _accounts.size())
+    {
+        for (uint32_t i = 0; i < trx_per_block && _posts.size() < _accounts.size(); ++i)
+            _db->push_transaction(make_transaction(workload_comments, seq++), database::skip_nothing);
+
+        blocks.push_back(generate_block());
+    }
+
+    return blocks;
+}
+
+std::vector<signed_block> synthetic_chain::generate(uint32_t blocks_count, uint32_t trx_per_block, uint32_t workload)
+{
+    FC_ASSERT(trx_per_block <= _accounts.size(), "Every account may appear in block only once.");
+
+    std::vector<signed_block> blocks;
+    blocks.reserve(blocks_count);
+
+    uint32_t seq = 0;
+    for (uint32_t i = 0; i < blocks_count; ++i)
+    {
+        for (uint32_t j = 0; j < trx_per_block; ++j)
+            _db->push_transaction(make_transaction(workload, seq++), database::skip_nothing);
+
+        blocks.push_back(generate_block());
+    }
+
+    return blocks;
+}
+
+void synthetic_chain::close()
+{
+    if (_db)
+    {
+        _db->close();
+        _db.reset();
+    }
+}
+
+signed_transaction synthetic_chain::make_transaction(uint32_t workload, uint32_t seq)
+{
+    const uint32_t idx = _next_account++ % _accounts.size();
+    const Actor& actor = _accounts[idx];
+
+    std::vector<uint32_t> kinds;
+    for (uint32_t kind : { workload_transfers, workload_comments, workload_votes })
+    {
+        if (workload & kind)
+            kinds.push_back(kind);
+    }
+    FC_ASSERT(!kinds.empty(), "Unknown workload.");
+
+    const uint32_t kind = kinds[seq % kinds.size()];
+
+    // the mixed workload may replace a comment with a transfer, the pure one must not measure transfers instead
+    FC_ASSERT(workload != workload_comments || _posts.size() < _accounts.size(),
+              "All ${n} accounts have already posted, increase the number of accounts.", ("n", _accounts.size()));
+
+    signed_transaction tx;
+
+    if (kind == workload_comments && std::find(_posts.begin(), _posts.end(), idx) == _posts.end())
+    {
+        comment_operation op;
+        op.author = actor.name;
+        op.permlink = "post-" + actor.name;
+        op.parent_permlink = "bench";
+        op.title = "Benchmark post of " + actor.name;
+        op.body = std::string(512, 'x');
+        op.json_metadata = R"({"tags":["bench"]})";
+
+        tx.operations.push_back(op);
+        _posts.push_back(idx);
+    }
+    else if (kind == workload_votes && !_posts.empty())
+    {
+        // probe a few posts in a pseudo-random order to find one which is not voted by actor yet
+        for (uint32_t probe = 0; probe < 16 && tx.operations.empty(); ++probe)
+        {
+            uint32_t author = _posts[(seq * 7919 + probe * 104729) % _posts.size()];
+            if (author == idx || !_votes.insert(std::make_pair(idx, author)).second)
+                continue;
+
+            vote_operation op;
+            op.voter = actor.name;
+            op.author = _accounts[author].name;
+            op.permlink = "post-" + _accounts[author].name;
+            op.weight = SCORUM_PERCENT(10);
+
+            tx.operations.push_back(op);
+        }
+    }
+
+    if (tx.operations.empty())
+    {
+        transfer_operation op;
+        op.from = actor.name;
+        op.to = _accounts[(idx + 1) % _accounts.size()].name;
+        op.amount = ASSET_SCR(1);
+        op.memo = std::to_string(seq);
+
+        tx.operations.push_back(op);
+    }
+
+    tx.set_expiration(_db->head_block_time() + SCORUM_MAX_TIME_UNTIL_EXPIRATION);
+    tx.set_reference_block(_db->head_block_id());
+    tx.sign(actor.private_key, _db->get_chain_id());
+
+    return tx;
+}
+
+signed_block synthetic_chain::generate_block()
+{
+    return _db->generate_block(_db->get_slot_time(1), _db->get_scheduled_witness(1), _witness.private_key,
+                               database::skip_nothing);
+}
+
+} // namespace bench
+} // namespace scorum
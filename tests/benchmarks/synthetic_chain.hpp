@@ -0,0 +1,83 @@
+#pragma once
+
+#include <memory>
+#include <set>
+#include <vector>
+
+#include <fc/filesystem.hpp>
+
+#include <scorum/chain/database/database.hpp>
+#include <scorum/chain/genesis/genesis_state.hpp>
+
+#include "actor.hpp"
+
+#define BENCH_CHAIN_SHARED_MEM_SIZE (1024ull * 1024 * 1024)
+
+namespace scorum {
+namespace bench {
+
+using scorum::chain::database;
+using scorum::chain::genesis_state_type;
+using scorum::protocol::signed_block;
+using scorum::protocol::signed_transaction;
+
+enum workload_type
+{
+    workload_transfers = 1 << 0,
+    workload_comments = 1 << 1,
+    workload_votes = 1 << 2,
+
+    workload_mixed = workload_transfers | workload_comments | workload_votes
+};
+
+/**
+ * Produces a reproducible chain with a single witness and a lot of funded accounts.
+ * The same genesis can be used to open another database and push produced blocks to it.
+ */
+class synthetic_chain
+{
+public:
+    synthetic_chain(uint32_t accounts_count, const fc::path& dir);
+    ~synthetic_chain();
+
+    database& db()
+    {
+        return *_db;
+    }
+
+    const genesis_state_type& genesis() const
+    {
+        return _genesis;
+    }
+
+    const fc::path& data_dir() const
+    {
+        return _dir;
+    }
+
+    /// opens new empty database which shares the genesis of this chain
+    std::unique_ptr<database> open_replica(const fc::path& dir) const;
+
+    /// makes every account publish one post, so votes workload has something to vote for
+    std::vector<signed_block> generate_posts(uint32_t trx_per_block);
+
+    std::vector<signed_block> generate(uint32_t blocks_count, uint32_t trx_per_block, uint32_t workload);
+
+    void close();
+
+private:
+    signed_transaction make_transaction(uint32_t workload, uint32_t seq);
+    signed_block generate_block();
+
+    fc::path _dir;
+    Actor _witness;
+    std::vector<Actor> _accounts;
+    std::vector<uint32_t> _posts;
+    std::set<std::pair<uint32_t, uint32_t>> _votes;
+    genesis_state_type _genesis;
+    std::unique_ptr<database> _db;
+    uint32_t _next_account = 0;
+};
+
+} // namespace bench
+} // namespace scorum
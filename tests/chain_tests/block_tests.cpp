@@ -25,6 +25,7 @@
 
 #include <scorum/protocol/exceptions.hpp>
 
+#include <scorum/chain/block_log.hpp>
 #include <scorum/chain/database/database.hpp>
 #include <scorum/chain/schema/scorum_objects.hpp>
 #include <scorum/blockchain_history/schema/operation_objects.hpp>
@@ -38,6 +39,10 @@
 
 #include <fc/crypto/digest.hpp>
 
+#include <atomic>
+#include <exception>
+#include <thread>
+
 #include "database_default_integration.hpp"
 #include "database_integration.hpp"
 
@@ -141,6 +146,176 @@ BOOST_AUTO_TEST_CASE(generate_empty_blocks)
     }
 }
 
+BOOST_AUTO_TEST_CASE(fetch_block_range)
+{
+    try
+    {
+        fc::temp_directory data_dir(graphene::utilities::temp_directory_path());
+        auto init_account_priv_key = fc::ecc::private_key::regenerate(fc::sha256::hash(std::string(TEST_INIT_KEY)));
+
+        database db(database::opt_default);
+        db_setup_and_open(db, data_dir.path());
+
+        while (db.obtain_service<dbs_dynamic_global_property>().get().last_irreversible_block_num < 10)
+        {
+            db.generate_block(db.get_slot_time(1), db.get_scheduled_witness(1), init_account_priv_key,
+                              database::skip_nothing);
+        }
+
+        // range covers both irreversible blocks from block_log and reversible blocks from fork_db
+        auto blocks = db.fetch_block_range(5, db.head_block_num());
+
+        BOOST_REQUIRE_EQUAL(blocks.size(), db.head_block_num() - 4);
+        for (uint32_t i = 0; i < blocks.size(); ++i)
+        {
+            auto block = db.fetch_block_by_number(5 + i);
+            BOOST_REQUIRE(block.valid());
+            BOOST_CHECK(blocks[i].id() == block->id());
+        }
+
+        BOOST_CHECK(db.fetch_block_range(db.head_block_num() + 1, 10).empty());
+
+        db.close();
+    }
+    catch (fc::exception& e)
+    {
+        edump((e.to_detail_string()));
+        throw;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(block_log_read_block_by_num)
+{
+    try
+    {
+        fc::temp_directory dir(graphene::utilities::temp_directory_path());
+
+        block_log log;
+        log.open(dir.path() / "block_log");
+
+        std::vector<block_id_type> ids;
+        for (uint32_t num = 1; num <= 5; ++num)
+        {
+            signed_block b;
+            b.previous = ids.empty() ? block_id_type() : ids.back();
+            b.timestamp = fc::time_point_sec(num * SCORUM_BLOCK_INTERVAL);
+            b.witness = "initdelegate";
+
+            log.append(b);
+            ids.push_back(b.id());
+        }
+
+        // appended blocks are read after flush
+        BOOST_CHECK(!log.read_block_by_num(1).valid());
+
+        log.flush();
+
+        // the second read of each block comes from the cache
+        for (int i = 0; i < 2; ++i)
+        {
+            for (uint32_t num = 1; num <= 5; ++num)
+            {
+                auto b = log.read_block_by_num(num);
+                BOOST_REQUIRE(b.valid());
+                BOOST_CHECK(b->id() == ids[num - 1]);
+            }
+        }
+
+        BOOST_CHECK(!log.read_block_by_num(0).valid());
+        BOOST_CHECK(!log.read_block_by_num(6).valid());
+    }
+    catch (fc::exception& e)
+    {
+        edump((e.to_detail_string()));
+        throw;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(read_only_block_log_refreshed_by_concurrent_readers)
+{
+    try
+    {
+        fc::temp_directory dir(graphene::utilities::temp_directory_path());
+
+        block_log writer;
+        writer.open(dir.path() / "block_log");
+
+        std::vector<block_id_type> ids;
+        auto append = [&](uint32_t count) {
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                signed_block b;
+                b.previous = ids.empty() ? block_id_type() : ids.back();
+                b.timestamp = fc::time_point_sec((ids.size() + 1) * SCORUM_BLOCK_INTERVAL);
+                b.witness = "initdelegate";
+
+                writer.append(b);
+                ids.push_back(b.id());
+            }
+            writer.flush();
+        };
+
+        append(10);
+
+        block_log reader;
+        reader.open_read_only(dir.path() / "block_log");
+
+        BOOST_CHECK_EQUAL(reader.readable_head_num(), 0u);
+
+        // the writer appends more blocks while readers refresh the head and read it
+        append(90);
+
+        static const uint32_t threads_count = 4;
+        std::vector<std::thread> threads;
+        std::vector<std::exception_ptr> errors(threads_count);
+        std::atomic<uint32_t> wrong_blocks{ 0 };
+
+        for (uint32_t t = 0; t < threads_count; ++t)
+        {
+            threads.emplace_back([&, t]() {
+                try
+                {
+                    for (uint32_t num = 1 + t; num <= ids.size(); num += threads_count)
+                    {
+                        reader.refresh_head(num);
+
+                        auto b = reader.read_block_by_num(num);
+                        if (!b.valid() || b->id() != ids[num - 1])
+                            ++wrong_blocks;
+                    }
+                }
+                catch (...)
+                {
+                    errors[t] = std::current_exception();
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        for (const auto& error : errors)
+        {
+            if (error)
+                std::rethrow_exception(error);
+        }
+
+        BOOST_CHECK_EQUAL(wrong_blocks, 0u);
+        BOOST_CHECK_EQUAL(reader.readable_head_num(), 100u);
+
+        // refreshing to an older block does not move the head back
+        reader.refresh_head(50);
+        BOOST_CHECK_EQUAL(reader.readable_head_num(), 100u);
+        BOOST_REQUIRE(reader.head().valid());
+        BOOST_CHECK(reader.head()->id() == ids.back());
+    }
+    catch (fc::exception& e)
+    {
+        edump((e.to_detail_string()));
+        throw;
+    }
+}
+
 BOOST_AUTO_TEST_CASE(undo_block)
 {
     try
@@ -394,6 +569,52 @@ BOOST_AUTO_TEST_CASE(duplicate_transactions)
     }
 }
 
+BOOST_AUTO_TEST_CASE(get_recent_transaction)
+{
+    try
+    {
+        fc::temp_directory dir1(graphene::utilities::temp_directory_path());
+        fc::temp_directory dir2(graphene::utilities::temp_directory_path());
+
+        database db1(database::opt_default);
+        db_setup_and_open(db1, dir1.path());
+        database db2(database::opt_default);
+        db_setup_and_open(db2, dir2.path());
+
+        auto skip_sigs = database::skip_transaction_signatures | database::skip_authority_check;
+
+        auto init_account_priv_key = fc::ecc::private_key::regenerate(fc::sha256::hash(std::string(TEST_INIT_KEY)));
+
+        signed_transaction trx;
+        transfer_operation t;
+        t.from = TEST_INIT_DELEGATE_NAME;
+        t.to = TEST_INIT_DELEGATE_NAME;
+        t.amount = asset(500, SCORUM_SYMBOL);
+        trx.operations.push_back(t);
+        trx.set_expiration(db1.head_block_time() + SCORUM_MAX_TIME_UNTIL_EXPIRATION);
+        trx.sign(init_account_priv_key, db1.get_chain_id());
+        PUSH_TX(db1, trx, skip_sigs);
+
+        // pending transaction
+        BOOST_CHECK(db1.get_recent_transaction(trx.id()).id() == trx.id());
+
+        auto b
+            = db1.generate_block(db1.get_slot_time(1), db1.get_scheduled_witness(1), init_account_priv_key, skip_sigs);
+        PUSH_BLOCK(db2, b, skip_sigs);
+
+        // transaction of the block
+        BOOST_CHECK(db1.get_recent_transaction(trx.id()).id() == trx.id());
+        BOOST_CHECK(db2.get_recent_transaction(trx.id()).id() == trx.id());
+
+        SCORUM_CHECK_THROW(db2.get_recent_transaction(transaction_id_type()), fc::exception);
+    }
+    catch (fc::exception& e)
+    {
+        edump((e.to_detail_string()));
+        throw;
+    }
+}
+
 BOOST_AUTO_TEST_CASE(tapos)
 {
     try
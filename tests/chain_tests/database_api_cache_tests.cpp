@@ -0,0 +1,189 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/app/api_context.hpp>
+#include <scorum/app/database_api.hpp>
+
+#include <scorum/chain/schema/account_objects.hpp>
+
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include "database_trx_integration.hpp"
+
+using namespace scorum;
+using namespace scorum::app;
+using namespace scorum::protocol;
+
+namespace database_api_cache_tests {
+
+struct database_api_cache_fixture : public database_fixture::database_trx_integration_fixture
+{
+    api_context _api_ctx;
+    database_api _api;
+
+    Actor alice = Actor("alice");
+
+    database_api_cache_fixture()
+        : _api_ctx(app, "database_api", std::make_shared<api_session_data>())
+        , _api(_api_ctx)
+    {
+        open_database();
+
+        actor(initdelegate).create_account(alice);
+        actor(initdelegate).give_scr(alice, 100);
+
+        generate_block();
+    }
+
+    asset get_api_balance(const std::string& name)
+    {
+        auto accounts = _api.get_accounts({ name });
+        BOOST_REQUIRE_EQUAL(accounts.size(), 1u);
+        return accounts[0].balance;
+    }
+};
+
+} // namespace database_api_cache_tests
+
+BOOST_FIXTURE_TEST_SUITE(database_api_cache_tests, database_api_cache_tests::database_api_cache_fixture)
+
+SCORUM_TEST_CASE(repeated_calls_return_the_same_result)
+{
+    BOOST_CHECK_EQUAL(get_api_balance(alice.name), get_api_balance(alice.name));
+
+    auto first = _api.get_dynamic_global_properties();
+    auto second = _api.get_dynamic_global_properties();
+
+    BOOST_CHECK_EQUAL(first.head_block_number, second.head_block_number);
+    BOOST_CHECK(first.head_block_id == second.head_block_id);
+}
+
+SCORUM_TEST_CASE(pending_transaction_invalidates_accounts)
+{
+    const asset balance = get_api_balance(alice.name);
+
+    transfer(initdelegate.name, alice.name, ASSET_SCR(10));
+
+    BOOST_CHECK_EQUAL(get_api_balance(alice.name), balance + ASSET_SCR(10));
+}
+
+SCORUM_TEST_CASE(new_block_invalidates_global_properties)
+{
+    const uint32_t head = _api.get_dynamic_global_properties().head_block_number;
+
+    generate_block();
+
+    BOOST_CHECK_EQUAL(_api.get_dynamic_global_properties().head_block_number, head + 1);
+    BOOST_CHECK_EQUAL(_api.get_dynamic_global_properties().head_block_number, db.head_block_num());
+}
+
+SCORUM_TEST_CASE(missing_account_is_not_returned)
+{
+    BOOST_CHECK(_api.get_accounts({ "nobody" }).empty());
+
+    BOOST_CHECK_EQUAL(_api.get_accounts({ "nobody", alice.name }).size(), 1u);
+}
+
+SCORUM_TEST_CASE(api_is_called_from_threads_while_blocks_are_applied)
+{
+    static const int threads_count = 4;
+
+    const asset balance = get_api_balance(alice.name);
+
+    std::atomic<bool> stop{ false };
+    std::atomic<int> calls{ 0 };
+    std::atomic<int> failed{ 0 };
+    std::vector<std::exception_ptr> errors(threads_count);
+
+    // Boost.Test macros are not thread safe, the threads check with FC_ASSERT
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threads_count; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            try
+            {
+                while (!stop)
+                {
+                    FC_ASSERT(_api.get_accounts({ alice.name, initdelegate.name }).size() == 2u);
+                    FC_ASSERT(_api.get_dynamic_global_properties().head_block_number > 0u);
+                    FC_ASSERT(_api.get_witness_by_account(initdelegate.name).valid());
+                    FC_ASSERT(_api.get_account_count() > 0u);
+                    _api.get_witness_schedule();
+                    _api.get_config();
+
+                    ++calls;
+                }
+            }
+            catch (...)
+            {
+                errors[t] = std::current_exception();
+                ++failed;
+            }
+        });
+    }
+
+    while (calls < threads_count && !failed)
+        std::this_thread::yield();
+
+    for (int i = 0; i < 10; ++i)
+    {
+        transfer(initdelegate.name, alice.name, ASSET_SCR(1));
+        generate_block();
+    }
+
+    stop = true;
+    for (auto& thread : threads)
+        thread.join();
+
+    for (const auto& error : errors)
+    {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    BOOST_CHECK_GE(calls, threads_count);
+    BOOST_CHECK_EQUAL(get_api_balance(alice.name), balance + ASSET_SCR(10));
+}
+
+SCORUM_TEST_CASE(required_lock_is_held_by_the_calling_thread)
+{
+    std::exception_ptr unlocked_error;
+    std::exception_ptr locked_error;
+
+    db.set_require_locking(true);
+
+    db.with_read_lock([&]() {
+        BOOST_CHECK(db.find<account_object, by_name>(alice.name) != nullptr);
+
+        // the lock of this thread does not allow other threads to read
+        std::thread([&]() {
+            try
+            {
+                db.find<account_object, by_name>(alice.name);
+            }
+            catch (...)
+            {
+                unlocked_error = std::current_exception();
+            }
+
+            try
+            {
+                db.with_read_lock([&]() { db.find<account_object, by_name>(alice.name); });
+            }
+            catch (...)
+            {
+                locked_error = std::current_exception();
+            }
+        }).join();
+    });
+
+    db.set_require_locking(false);
+
+    BOOST_REQUIRE(unlocked_error);
+    BOOST_CHECK_THROW(std::rethrow_exception(unlocked_error), std::runtime_error);
+    BOOST_CHECK(!locked_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,132 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/chain/services/dynamic_global_property.hpp>
+#include <scorum/chain/schema/dynamic_global_property_object.hpp>
+
+#include "database_default_integration.hpp"
+
+namespace database_fixture {
+
+class dynamic_global_property_service_fixture : public database_default_integration_fixture
+{
+public:
+    dynamic_global_property_service_fixture()
+        : service(db.obtain_service<dbs_dynamic_global_property>())
+    {
+    }
+
+    dbs_dynamic_global_property& service;
+};
+
+} // database_fixture
+
+using namespace scorum::chain;
+using namespace scorum::protocol;
+
+BOOST_FIXTURE_TEST_SUITE(dynamic_global_property_service_tests,
+                         database_fixture::dynamic_global_property_service_fixture)
+
+SCORUM_TEST_CASE(pending_supply_is_written_by_flush)
+{
+    const asset capital = service.get().circulating_capital;
+    const asset scorumpower = service.get().total_scorumpower;
+
+    service.accumulate_supply(ASSET_SCR(10), ASSET_SP(5));
+    service.accumulate_supply(ASSET_SCR(-3), ASSET_SP(2));
+
+    BOOST_CHECK_EQUAL(service.get().circulating_capital, capital);
+    BOOST_CHECK_EQUAL(service.get().total_scorumpower, scorumpower);
+
+    BOOST_CHECK_EQUAL(service.get_circulating_capital(), capital + ASSET_SCR(7));
+    BOOST_CHECK_EQUAL(service.get_total_scorumpower(), scorumpower + ASSET_SP(7));
+
+    service.flush_supply();
+
+    BOOST_CHECK_EQUAL(service.get().circulating_capital, capital + ASSET_SCR(7));
+    BOOST_CHECK_EQUAL(service.get().total_scorumpower, scorumpower + ASSET_SP(7));
+    BOOST_CHECK_EQUAL(service.get_circulating_capital(), capital + ASSET_SCR(7));
+
+    service.accumulate_supply(ASSET_SCR(-7), ASSET_SP(-7));
+    service.flush_supply();
+}
+
+SCORUM_TEST_CASE(update_writes_pending_supply)
+{
+    const asset capital = service.get().circulating_capital;
+
+    service.accumulate_supply(ASSET_SCR(10), ASSET_SP(0));
+
+    service.update([&](dynamic_global_property_object& o) {
+        BOOST_CHECK_EQUAL(o.circulating_capital, capital + ASSET_SCR(10));
+        o.circulating_capital -= ASSET_SCR(10);
+    });
+
+    BOOST_CHECK_EQUAL(service.get().circulating_capital, capital);
+    BOOST_CHECK_EQUAL(service.get_circulating_capital(), capital);
+}
+
+SCORUM_TEST_CASE(guard_discards_supply_on_exception)
+{
+    const asset capital = service.get().circulating_capital;
+
+    try
+    {
+        supply_batch_guard guard(service);
+
+        service.accumulate_supply(ASSET_SCR(10), ASSET_SP(10));
+
+        FC_THROW("block failed to apply");
+    }
+    catch (const fc::exception&)
+    {
+    }
+
+    BOOST_CHECK_EQUAL(service.get_circulating_capital(), capital);
+
+    service.flush_supply();
+
+    BOOST_CHECK_EQUAL(service.get().circulating_capital, capital);
+}
+
+SCORUM_TEST_CASE(guard_flush_writes_supply)
+{
+    const asset scorumpower = service.get().total_scorumpower;
+
+    {
+        supply_batch_guard guard(service);
+
+        service.accumulate_supply(ASSET_SCR(0), ASSET_SP(10));
+
+        guard.flush();
+    }
+
+    BOOST_CHECK_EQUAL(service.get().total_scorumpower, scorumpower + ASSET_SP(10));
+
+    service.accumulate_supply(ASSET_SCR(0), ASSET_SP(-10));
+    service.flush_supply();
+}
+
+SCORUM_TEST_CASE(totals_are_written_after_block_with_withdrawal)
+{
+    Actor alice("alice");
+    actor(initdelegate).create_account(alice);
+    actor(initdelegate).give_sp(alice, 1000);
+    generate_block();
+
+    withdraw_scorumpower_operation op;
+    op.account = alice.name;
+    op.scorumpower = ASSET_SP(1000);
+    push_operation(op, alice.private_key);
+
+    const asset scorumpower = service.get().total_scorumpower;
+
+    generate_blocks(db.head_block_time() + SCORUM_VESTING_WITHDRAW_INTERVAL_SECONDS);
+
+    // block tasks have withdrawn the scorumpower and nothing is left pending after the block
+    BOOST_CHECK_LT(service.get().total_scorumpower, scorumpower);
+    BOOST_CHECK_EQUAL(service.get_total_scorumpower(), service.get().total_scorumpower);
+
+    validate_database();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
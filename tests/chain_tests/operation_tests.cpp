@@ -18,6 +18,7 @@
 #include <scorum/chain/services/witness.hpp>
 #include <scorum/chain/services/escrow.hpp>
 #include <scorum/chain/services/comment.hpp>
+#include <scorum/chain/services/comment_content.hpp>
 #include <scorum/chain/services/dynamic_global_property.hpp>
 
 #include <cmath>
@@ -465,13 +466,12 @@ BOOST_AUTO_TEST_CASE(comment_apply)
                       == fc::time_point_sec(db.head_block_time() + fc::seconds(SCORUM_CASHOUT_WINDOW_SECONDS)));
 
 #ifndef IS_LOW_MEM
-        BOOST_REQUIRE(fc::to_string(alice_comment.title) == op.title);
-        BOOST_REQUIRE(fc::to_string(alice_comment.body) == op.body);
-// BOOST_REQUIRE( alice_comment.json_metadata == op.json_metadata );
+        const comment_content_object& alice_content = db.obtain_service<dbs_comment_content>().get(alice_comment.id);
+        BOOST_REQUIRE(fc::to_string(alice_content.title) == op.title);
+        BOOST_REQUIRE(fc::to_string(alice_content.body) == op.body);
+        BOOST_REQUIRE(fc::to_string(alice_content.json_metadata) == op.json_metadata);
 #else
-        BOOST_REQUIRE(fc::to_string(alice_comment.title) == "");
-        BOOST_REQUIRE(fc::to_string(alice_comment.body) == "");
-// BOOST_REQUIRE( alice_comment.json_metadata == "" );
+        BOOST_REQUIRE(db.obtain_service<dbs_comment_content>().find(alice_comment.id) == nullptr);
 #endif
 
         validate_database();
@@ -568,6 +568,12 @@ BOOST_AUTO_TEST_CASE(comment_apply)
         BOOST_REQUIRE(mod_sam_comment.last_update == db.head_block_time());
         BOOST_REQUIRE(mod_sam_comment.created == created);
         BOOST_REQUIRE(mod_sam_comment.cashout_time == mod_sam_comment.created + SCORUM_CASHOUT_WINDOW_SECONDS);
+#ifndef IS_LOW_MEM
+        const comment_content_object& sam_content = db.obtain_service<dbs_comment_content>().get(mod_sam_comment.id);
+        BOOST_REQUIRE(fc::to_string(sam_content.title) == op.title);
+        BOOST_REQUIRE(fc::to_string(sam_content.body) == op.body);
+        BOOST_REQUIRE(fc::to_string(sam_content.json_metadata) == op.json_metadata);
+#endif
         validate_database();
 
         BOOST_TEST_MESSAGE("--- Test failure posting withing 1 minute");
@@ -650,10 +656,13 @@ BOOST_AUTO_TEST_CASE(comment_delete_apply)
         tx.operations.push_back(vote);
         tx.operations.push_back(op);
         tx.sign(alice_private_key, db.get_chain_id());
+        comment_id_type test_comment_id = db.obtain_service<dbs_comment>().get("alice", std::string("test1")).id;
+
         db.push_transaction(tx, 0);
 
         auto test_comment = db.find<comment_object, by_permlink>(boost::make_tuple("alice", std::string("test1")));
         BOOST_REQUIRE(test_comment == nullptr);
+        BOOST_REQUIRE(db.obtain_service<dbs_comment_content>().find(test_comment_id) == nullptr);
 
         BOOST_TEST_MESSAGE("--- Test failure deleting a comment past cashout");
         generate_blocks(SCORUM_MIN_ROOT_COMMENT_INTERVAL.to_seconds() / SCORUM_BLOCK_INTERVAL);
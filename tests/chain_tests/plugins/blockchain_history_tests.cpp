@@ -605,7 +605,7 @@ SCORUM_TEST_CASE(check_get_ops_in_block)
     saved_operation_vector_type saved_ops;
 
     // expect transfer_to_scorumpower_operation, witness_update_operation
-    operation_map_type ret = blockchain_history_api_call.get_ops_in_block(
+    blockchain_history::applied_operation_map_type ret = blockchain_history_api_call.get_ops_in_block(
         dpo_service.get().head_block_number, blockchain_history::applied_operation_type::not_virt);
     BOOST_REQUIRE_EQUAL(ret.size(), 2u);
 
@@ -704,13 +704,13 @@ SCORUM_TEST_CASE(check_get_ops_history)
                              -1, MAX_BLOCKCHAIN_HISTORY_DEPTH + 1, blockchain_history::applied_operation_type::market),
                          fc::exception);
 
-    operation_map_type ret1
+    blockchain_history::applied_operation_map_type ret1
         = blockchain_history_api_call.get_ops_history(-1, 1, blockchain_history::applied_operation_type::market);
     BOOST_REQUIRE_EQUAL(ret1.size(), 1u);
 
     auto next_page_id = ret1.begin()->first;
     next_page_id--;
-    operation_map_type ret2 = blockchain_history_api_call.get_ops_history(
+    blockchain_history::applied_operation_map_type ret2 = blockchain_history_api_call.get_ops_history(
         next_page_id, 2, blockchain_history::applied_operation_type::market);
     BOOST_REQUIRE_EQUAL(ret2.size(), 2u);
 
@@ -758,3 +758,70 @@ SCORUM_TEST_CASE(check_get_ops_history)
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+namespace blockchain_history_tests {
+struct history_retention_database_fixture : public database_fixture::database_trx_integration_fixture
+{
+    history_retention_database_fixture()
+        : buratino("buratino")
+    {
+        boost::program_options::variables_map options;
+        options.insert(std::make_pair("history-retention-ops-per-account",
+                                      boost::program_options::variable_value(uint32_t(2), false)));
+
+        init_plugin<scorum::blockchain_history::blockchain_history_plugin>(options);
+
+        open_database();
+        generate_block();
+        validate_database();
+    }
+
+    template <typename history_object_type> std::vector<uint32_t> get_sequences(const std::string& account_name)
+    {
+        const auto& idx = db.get_index<blockchain_history::history_index<history_object_type>>()
+                              .indices()
+                              .get<blockchain_history::by_account>();
+
+        std::vector<uint32_t> result;
+        for (auto itr = idx.lower_bound(boost::make_tuple(account_name, uint32_t(-1)));
+             itr != idx.end() && itr->account == account_name; ++itr)
+        {
+            result.push_back(itr->sequence);
+        }
+        return result;
+    }
+
+    Actor buratino;
+};
+} // namespace blockchain_history_tests
+
+BOOST_FIXTURE_TEST_SUITE(history_retention_tests, blockchain_history_tests::history_retention_database_fixture)
+
+SCORUM_TEST_CASE(keep_last_operations_of_account)
+{
+    actor(initdelegate).create_account(buratino);
+    actor(initdelegate).give_scr(buratino, SCORUM_MIN_PRODUCER_REWARD.amount.value);
+    actor(initdelegate).give_scr(buratino, SCORUM_MIN_PRODUCER_REWARD.amount.value);
+    actor(initdelegate).give_scr(buratino, SCORUM_MIN_PRODUCER_REWARD.amount.value);
+
+    // operations are reversible yet, so nothing is removed
+    BOOST_REQUIRE(get_sequences<blockchain_history::account_history_object>(buratino)
+                  == std::vector<uint32_t>({ 3u, 2u, 1u, 0u }));
+
+    generate_blocks(SCORUM_MAX_WITNESSES + 1);
+
+    const auto& op_idx = db.get_index<blockchain_history::operation_index>().indices();
+    const size_t operations_count = op_idx.size();
+
+    actor(initdelegate).give_scr(buratino, SCORUM_MIN_PRODUCER_REWARD.amount.value);
+
+    BOOST_REQUIRE(get_sequences<blockchain_history::account_history_object>(buratino)
+                  == std::vector<uint32_t>({ 4u, 3u }));
+    BOOST_REQUIRE(get_sequences<blockchain_history::transfers_to_scr_history_object>(buratino)
+                  == std::vector<uint32_t>({ 3u, 2u }));
+
+    // operations of the removed entries stay in the blockchain history
+    BOOST_CHECK_GT(op_idx.size(), operations_count);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
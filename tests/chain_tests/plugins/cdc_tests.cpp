@@ -0,0 +1,236 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/plugins/cdc/cdc_plugin.hpp>
+#include <scorum/plugins/cdc/cdc_stream.hpp>
+
+#include <scorum/chain/services/dynamic_global_property.hpp>
+#include <scorum/chain/schema/dynamic_global_property_object.hpp>
+
+#include <graphene/utilities/tempdir.hpp>
+
+#include <fc/io/raw.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+
+#include "database_trx_integration.hpp"
+
+using namespace scorum;
+using namespace scorum::chain;
+using namespace scorum::protocol;
+using namespace scorum::plugin::cdc;
+
+namespace cdc_tests {
+
+struct cdc_fixture : public database_fixture::database_trx_integration_fixture
+{
+    cdc_fixture()
+        : stream_dir(graphene::utilities::temp_directory_path())
+        , stream_file(stream_dir.path() / "cdc" / "state_changes.bin")
+    {
+        boost::program_options::variables_map options;
+        options.insert(std::make_pair(
+            "cdc-file", boost::program_options::variable_value(boost::filesystem::path(stream_file.string()), false)));
+
+        plugin = init_plugin<cdc_plugin>(options);
+
+        open_database();
+    }
+
+    template <typename record_type> std::vector<record_type> get_records()
+    {
+        std::vector<record_type> result;
+        for (const cdc_record& record : read_cdc_stream(stream_file))
+        {
+            if (record.which() == cdc_record::tag<record_type>::value)
+                result.push_back(record.get<record_type>());
+        }
+        return result;
+    }
+
+    // parses the file frame by frame without read_cdc_stream, the whole file must be covered by the frames
+    uint32_t count_frames()
+    {
+        const uint64_t file_size = boost::filesystem::file_size(stream_file);
+
+        std::ifstream in(stream_file.generic_string().c_str(), std::ios::binary);
+
+        char magic[8] = {};
+        in.read(magic, sizeof(magic));
+        BOOST_REQUIRE_EQUAL(std::string(magic, sizeof(magic)), "SCRCDC01");
+
+        uint64_t pos = sizeof(magic);
+        uint32_t frames = 0;
+        while (pos < file_size)
+        {
+            uint32_t size = 0;
+            in.read((char*)&size, sizeof(size));
+            BOOST_REQUIRE(in);
+
+            std::vector<char> data(size);
+            in.read(data.data(), data.size());
+            BOOST_REQUIRE(in);
+
+            fc::raw::unpack<cdc_record>(data);
+
+            pos += sizeof(size) + size;
+            ++frames;
+        }
+
+        BOOST_CHECK_EQUAL(pos, file_size);
+
+        return frames;
+    }
+
+    fc::temp_directory stream_dir;
+    fc::path stream_file;
+
+    std::shared_ptr<cdc_plugin> plugin;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(cdc_tests, cdc_tests::cdc_fixture)
+
+SCORUM_TEST_CASE(records_are_framed)
+{
+    generate_block();
+
+    const auto records = read_cdc_stream(stream_file);
+
+    BOOST_REQUIRE_EQUAL(count_frames(), records.size());
+    BOOST_REQUIRE_EQUAL(records[0].which(), cdc_record::tag<applied_block_record>::value);
+
+    const auto& applied = records[0].get<applied_block_record>();
+    BOOST_CHECK_EQUAL(applied.block_num, 1u);
+    BOOST_CHECK_EQUAL(applied.block_id.str(), db.head_block_id().str());
+    BOOST_CHECK(applied.timestamp == db.head_block_time());
+    BOOST_CHECK(!applied.changes.empty());
+}
+
+SCORUM_TEST_CASE(block_is_popped_and_applied_on_fork_switch)
+{
+    generate_block();
+    const block_id_type first_fork_id = db.head_block_id();
+
+    // the second fork is produced by another node with the same genesis: 0 <- b1 <- b2
+    fc::temp_directory dir2(graphene::utilities::temp_directory_path());
+    database db2(database::opt_default);
+    db2.open(dir2.path(), dir2.path(), TEST_SHARED_MEM_SIZE_10MB, chainbase::database::read_write, genesis_state);
+
+    auto b1 = db2.generate_block(db2.get_slot_time(2), db2.get_scheduled_witness(2), initdelegate.private_key,
+                                 default_skip);
+    auto b2 = db2.generate_block(db2.get_slot_time(1), db2.get_scheduled_witness(1), initdelegate.private_key,
+                                 default_skip);
+
+    db.push_block(b1, default_skip);
+    BOOST_REQUIRE_EQUAL(db.head_block_id().str(), first_fork_id.str());
+
+    db.push_block(b2, default_skip);
+    BOOST_REQUIRE_EQUAL(db.head_block_id().str(), b2.id().str());
+
+    const auto records = read_cdc_stream(stream_file);
+    BOOST_REQUIRE_EQUAL(records.size(), 4u);
+
+    BOOST_REQUIRE_EQUAL(records[0].which(), cdc_record::tag<applied_block_record>::value);
+    BOOST_CHECK_EQUAL(records[0].get<applied_block_record>().block_id.str(), first_fork_id.str());
+
+    BOOST_REQUIRE_EQUAL(records[1].which(), cdc_record::tag<popped_block_record>::value);
+    BOOST_CHECK_EQUAL(records[1].get<popped_block_record>().block_num, 1u);
+    BOOST_CHECK_EQUAL(records[1].get<popped_block_record>().block_id.str(), first_fork_id.str());
+
+    BOOST_REQUIRE_EQUAL(records[2].which(), cdc_record::tag<applied_block_record>::value);
+    BOOST_CHECK_EQUAL(records[2].get<applied_block_record>().block_num, 1u);
+    BOOST_CHECK_EQUAL(records[2].get<applied_block_record>().block_id.str(), b1.id().str());
+    BOOST_CHECK(!records[2].get<applied_block_record>().changes.empty());
+
+    BOOST_REQUIRE_EQUAL(records[3].which(), cdc_record::tag<applied_block_record>::value);
+    BOOST_CHECK_EQUAL(records[3].get<applied_block_record>().block_num, 2u);
+    BOOST_CHECK_EQUAL(records[3].get<applied_block_record>().block_id.str(), b2.id().str());
+}
+
+SCORUM_TEST_CASE(irreversible_record_follows_last_irreversible_block)
+{
+    BOOST_CHECK(get_records<irreversible_block_record>().empty());
+
+    generate_blocks(SCORUM_MAX_WITNESSES + 2);
+
+    const uint32_t last_irreversible_block_num
+        = db.obtain_service<dbs_dynamic_global_property>().get().last_irreversible_block_num;
+    BOOST_REQUIRE_GT(last_irreversible_block_num, 0u);
+
+    const auto irreversible = get_records<irreversible_block_record>();
+    BOOST_REQUIRE(!irreversible.empty());
+    BOOST_CHECK_EQUAL(irreversible.back().block_num, last_irreversible_block_num);
+
+    for (size_t i = 1; i < irreversible.size(); ++i)
+        BOOST_CHECK_GT(irreversible[i].block_num, irreversible[i - 1].block_num);
+
+    BOOST_CHECK_EQUAL(get_records<applied_block_record>().size(), db.head_block_num());
+}
+
+SCORUM_TEST_CASE(reopened_stream_is_continued)
+{
+    generate_block();
+    plugin->plugin_shutdown();
+
+    const size_t records_count = read_cdc_stream(stream_file).size();
+
+    {
+        cdc_stream stream;
+        stream.open(stream_file);
+
+        popped_block_record record;
+        record.block_num = db.head_block_num();
+        record.block_id = db.head_block_id();
+        stream.write(record);
+    }
+
+    BOOST_CHECK_EQUAL(count_frames(), records_count + 1);
+
+    const auto popped = get_records<popped_block_record>();
+    BOOST_REQUIRE_EQUAL(popped.size(), 1u);
+    BOOST_CHECK_EQUAL(popped[0].block_id.str(), db.head_block_id().str());
+}
+
+SCORUM_TEST_CASE(partial_trailing_frame_is_truncated_on_open)
+{
+    generate_block();
+    plugin->plugin_shutdown();
+
+    const size_t records_count = read_cdc_stream(stream_file).size();
+    const uint64_t file_size = boost::filesystem::file_size(stream_file);
+
+    {
+        // the node crashed after writing the size and a part of the record
+        std::ofstream out(stream_file.generic_string().c_str(), std::ios::binary | std::ios::app);
+        const uint32_t size = 100;
+        out.write((const char*)&size, sizeof(size));
+        out.write("abc", 3);
+    }
+
+    BOOST_CHECK_EQUAL(read_cdc_stream(stream_file).size(), records_count);
+
+    {
+        cdc_stream stream;
+        stream.open(stream_file);
+
+        BOOST_CHECK_EQUAL(boost::filesystem::file_size(stream_file), file_size);
+
+        irreversible_block_record record;
+        record.block_num = db.head_block_num();
+        stream.write(record);
+    }
+
+    BOOST_CHECK_EQUAL(count_frames(), records_count + 1);
+    BOOST_CHECK_EQUAL(get_records<irreversible_block_record>().back().block_num, db.head_block_num());
+}
+
+SCORUM_TEST_CASE(not_a_regular_file_is_rejected)
+{
+    cdc_stream stream;
+
+    SCORUM_REQUIRE_THROW(stream.open(stream_dir.path()), fc::exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -147,6 +147,26 @@ SCORUM_TEST_CASE(get_discussions_by_created)
     }
 }
 
+SCORUM_TEST_CASE(get_discussions_truncates_body_and_skips_votes)
+{
+    create_post(initdelegate, [](comment_operation& op) {
+        op.title = "root post";
+        op.body = "0123456789";
+    });
+
+    api::discussion_query query;
+    query.limit = 1;
+    query.truncate_body = 4;
+    query.votes_limit = 0;
+
+    auto discussions = _api.get_discussions_by_created(query);
+
+    BOOST_REQUIRE_EQUAL(discussions.size(), 1u);
+    BOOST_CHECK_EQUAL(discussions[0].body, "0123");
+    BOOST_CHECK_EQUAL(discussions[0].body_length, 10u);
+    BOOST_CHECK(discussions[0].active_votes.empty());
+}
+
 SCORUM_TEST_CASE(test_depth)
 {
     auto get_comments_with_depth = [](scorum::chain::database& db) {
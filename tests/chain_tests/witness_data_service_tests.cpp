@@ -141,6 +141,62 @@ SCORUM_TEST_CASE(check_signing_key_reset)
     FC_LOG_AND_RETHROW()
 }
 
+SCORUM_TEST_CASE(check_get_witnesses_by_name)
+{
+    try
+    {
+        for (const char* name : { "dave", "bob", "carol", "alice" })
+            witness_service.create_witness(name, "", public_key_type(), chain_properties());
+
+        auto witnesses = witness_service.get_witnesses_by_name("bob", 2);
+
+        BOOST_REQUIRE_EQUAL(witnesses.size(), 2u);
+        BOOST_CHECK(witnesses[0].get().owner == account_name_type("bob"));
+        BOOST_CHECK(witnesses[1].get().owner == account_name_type("carol"));
+
+        // initdelegate comes after all created ones
+        witnesses = witness_service.get_witnesses_by_name("d", 10);
+
+        BOOST_REQUIRE_EQUAL(witnesses.size(), 2u);
+        BOOST_CHECK(witnesses[0].get().owner == account_name_type("dave"));
+        BOOST_CHECK(witnesses[1].get().owner == account_name_type(TEST_INIT_DELEGATE_NAME));
+
+        BOOST_CHECK(witness_service.get_witnesses_by_name("", 0).empty());
+    }
+    FC_LOG_AND_RETHROW()
+}
+
+SCORUM_TEST_CASE(check_witness_votes_batch)
+{
+    try
+    {
+        const witness_object& witness
+            = witness_service.create_witness("alice", "", public_key_type(), chain_properties());
+
+        witness_service.begin_witness_votes_batch();
+
+        witness_service.adjust_witness_vote(witness, 100);
+        witness_service.adjust_witness_vote(witness, -30);
+
+        BOOST_CHECK_EQUAL(witness.votes.value, 0);
+
+        witness_service.flush_witness_votes();
+
+        BOOST_CHECK_EQUAL(witness.votes.value, 70);
+
+        witness_service.adjust_witness_vote(witness, 10);
+        witness_service.discard_witness_votes_batch();
+
+        BOOST_CHECK_EQUAL(witness.votes.value, 70);
+
+        // out of the batch votes are written at once
+        witness_service.adjust_witness_vote(witness, -70);
+
+        BOOST_CHECK_EQUAL(witness.votes.value, 0);
+    }
+    FC_LOG_AND_RETHROW()
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif
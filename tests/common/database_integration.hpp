@@ -46,8 +46,11 @@ protected:
 
     template <class Plugin> std::shared_ptr<Plugin> init_plugin()
     {
-        boost::program_options::variables_map options;
+        return init_plugin<Plugin>(boost::program_options::variables_map());
+    }
 
+    template <class Plugin> std::shared_ptr<Plugin> init_plugin(const boost::program_options::variables_map& options)
+    {
         auto plugin = app.register_plugin<Plugin>();
         app.enable_plugin(plugin->plugin_name());
         plugin->plugin_initialize(options);
@@ -0,0 +1,71 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/app/api_metrics.hpp>
+
+using scorum::app::api_metrics;
+using scorum::app::api_method_stats;
+
+BOOST_AUTO_TEST_SUITE(api_metrics_tests)
+
+BOOST_AUTO_TEST_CASE(calls_are_counted_per_method)
+{
+    api_metrics metrics;
+
+    metrics.record_call("database_api", "get_state", fc::milliseconds(3), 100);
+    metrics.record_call("database_api", "get_state", fc::milliseconds(70), 200);
+    metrics.record_call("database_api", "get_block", fc::seconds(10), 10);
+    metrics.record_read_lock_wait("database_api", "get_state", 15);
+
+    const std::vector<api_method_stats> stats = metrics.get_stats();
+    BOOST_REQUIRE_EQUAL(stats.size(), 2u);
+
+    // ordered by api and method
+    const api_method_stats& get_block = stats[0];
+    const api_method_stats& get_state = stats[1];
+
+    BOOST_CHECK_EQUAL(get_state.method, "get_state");
+    BOOST_CHECK_EQUAL(get_state.calls, 2u);
+    BOOST_CHECK_EQUAL(get_state.total_latency_us, 73000u);
+    BOOST_CHECK_EQUAL(get_state.max_latency_us, 70000u);
+    BOOST_CHECK_EQUAL(get_state.response_bytes, 300u);
+    BOOST_CHECK_EQUAL(get_state.read_lock_wait_us, 15u);
+
+    BOOST_REQUIRE_EQUAL(get_state.latency_buckets.size(), api_metrics::latency_buckets_us.size() + 1);
+    BOOST_CHECK_EQUAL(get_state.latency_buckets[1], 1u); // <= 5ms
+    BOOST_CHECK_EQUAL(get_state.latency_buckets[5], 1u); // <= 100ms
+
+    BOOST_CHECK_EQUAL(get_block.method, "get_block");
+    BOOST_CHECK_EQUAL(get_block.latency_buckets.back(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(prometheus_text_has_cumulative_buckets)
+{
+    api_metrics metrics;
+
+    metrics.record_call("tags_api", "get_discussions_by_created", fc::milliseconds(1), 10);
+    metrics.record_call("tags_api", "get_discussions_by_created", fc::milliseconds(20), 10);
+
+    const std::string text = scorum::app::to_prometheus_text(metrics.get_stats());
+
+    const std::string labels = "api=\"tags_api\",method=\"get_discussions_by_created\"";
+
+    BOOST_CHECK_NE(text.find("scorum_api_call_duration_seconds_bucket{" + labels + ",le=\"0.001\"} 1\n"),
+                   std::string::npos);
+    BOOST_CHECK_NE(text.find("scorum_api_call_duration_seconds_bucket{" + labels + ",le=\"0.025\"} 2\n"),
+                   std::string::npos);
+    BOOST_CHECK_NE(text.find("scorum_api_call_duration_seconds_count{" + labels + "} 2\n"), std::string::npos);
+    BOOST_CHECK_NE(text.find("scorum_api_response_bytes_total{" + labels + "} 20\n"), std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(label_values_are_escaped)
+{
+    api_metrics metrics;
+
+    metrics.record_call("database_api", "get\"state", fc::milliseconds(1), 0);
+
+    const std::string text = scorum::app::to_prometheus_text(metrics.get_stats());
+
+    BOOST_CHECK_NE(text.find("method=\"get\\\"state\""), std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
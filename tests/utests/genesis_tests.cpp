@@ -1,7 +1,9 @@
 #include <boost/test/unit_test.hpp>
 
 #include <fc/io/json.hpp>
+#include <fc/filesystem.hpp>
 #include <scorum/chain/genesis/genesis_state.hpp>
+#include <scorum/chain/genesis/genesis_binary.hpp>
 
 namespace sc = scorum::chain;
 namespace sp = scorum::protocol;
@@ -83,4 +85,42 @@ BOOST_AUTO_TEST_CASE(check_rewards_supply)
     BOOST_CHECK(genesis_state.rewards_supply.symbol() == SCORUM_SYMBOL);
 }
 
+BOOST_AUTO_TEST_CASE(check_binary_genesis_round_trip)
+{
+    const std::string genesis_str = R"json(
+                                    {
+                                        "accounts_supply": "0.000003000 SCR",
+                                        "accounts":[
+                                        {
+                                            "name":"alice",
+                                            "public_key":"SCR1111111111111111111111111111111114T1Anm",
+                                            "scr_amount":"0.000001000 SCR"
+                                        },
+                                        {
+                                            "name":"bob",
+                                            "public_key":"SCR1111111111111111111111111111111114T1Anm",
+                                            "scr_amount":"0.000002000 SCR"
+                                        }],
+                                        "registration_committee":["alice"]
+                                    }
+                                    )json";
+
+    sc::genesis_state_type genesis_state = fc::json::from_string(genesis_str).as<sc::genesis_state_type>();
+    genesis_state.initial_chain_id = fc::sha256::hash(genesis_str);
+
+    fc::temp_directory dir;
+    const fc::path path = dir.path() / "genesis.bin";
+
+    sc::save_binary_genesis(path, genesis_state);
+
+    BOOST_REQUIRE_EQUAL(genesis_state.accounts.size(), 2u);
+    BOOST_REQUIRE(sc::is_binary_genesis(path));
+
+    sc::genesis_state_type loaded;
+    sc::load_binary_genesis(path, loaded);
+
+    BOOST_CHECK(loaded.initial_chain_id == genesis_state.initial_chain_id);
+    BOOST_CHECK_EQUAL(fc::json::to_string(loaded), fc::json::to_string(genesis_state));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
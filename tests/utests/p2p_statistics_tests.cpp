@@ -0,0 +1,226 @@
+#include <boost/test/unit_test.hpp>
+
+#include <graphene/net/node.hpp>
+#include <graphene/net/peer_connection.hpp>
+
+#include <scorum/app/api.hpp>
+#include <scorum/app/api_context.hpp>
+#include <scorum/app/application.hpp>
+
+#include <fc/filesystem.hpp>
+#include <fc/thread/thread.hpp>
+
+using namespace graphene::net;
+
+namespace p2p_statistics_tests {
+
+// a node without blocks, peers connected to it are in sync right after the handshake
+class empty_chain_delegate : public node_delegate
+{
+public:
+    bool has_item(const item_id&) override
+    {
+        return false;
+    }
+
+    bool handle_block(const block_message&, bool, std::vector<fc::uint160_t>&) override
+    {
+        return false;
+    }
+
+    void handle_transaction(const trx_message&) override
+    {
+    }
+
+    void handle_message(const message&) override
+    {
+    }
+
+    std::vector<item_hash_t> get_block_ids(const std::vector<item_hash_t>&, uint32_t& remaining_item_count, uint32_t)
+        override
+    {
+        remaining_item_count = 0;
+        return std::vector<item_hash_t>();
+    }
+
+    message get_item(const item_id& id) override
+    {
+        FC_THROW_EXCEPTION(fc::key_not_found_exception, "No item ${id}", ("id", id.item_hash));
+    }
+
+    chain_id_type get_chain_id() const override
+    {
+        return chain_id_type();
+    }
+
+    std::vector<item_hash_t> get_blockchain_synopsis(const item_hash_t&, uint32_t) override
+    {
+        return std::vector<item_hash_t>();
+    }
+
+    void sync_status(uint32_t, uint32_t) override
+    {
+    }
+
+    void connection_count_changed(uint32_t) override
+    {
+    }
+
+    uint32_t get_block_number(const item_hash_t&) override
+    {
+        return 0;
+    }
+
+    fc::time_point_sec get_block_time(const item_hash_t&) override
+    {
+        return fc::time_point_sec::min();
+    }
+
+    fc::time_point_sec get_blockchain_now() override
+    {
+        return fc::time_point::now();
+    }
+
+    item_hash_t get_head_block_id() const override
+    {
+        return item_hash_t();
+    }
+
+    uint32_t estimate_last_known_fork_from_git_revision_timestamp(uint32_t) const override
+    {
+        return 0;
+    }
+
+    void error_encountered(const std::string&, const fc::oexception&) override
+    {
+    }
+};
+
+struct p2p_node
+{
+    p2p_node()
+        : node(std::make_shared<graphene::net::node>("p2p_statistics_tests"))
+    {
+        node->load_configuration(dir.path());
+        node->set_node_delegate(&delegate);
+    }
+
+    ~p2p_node()
+    {
+        node->close();
+    }
+
+    fc::temp_directory dir;
+    empty_chain_delegate delegate;
+    node_ptr node;
+};
+
+// the p2p threads call the delegate on this thread, so it must yield while waiting
+template <typename Condition> bool wait_for(Condition&& condition)
+{
+    const fc::time_point deadline = fc::time_point::now() + fc::seconds(10);
+    while (!condition())
+    {
+        if (fc::time_point::now() > deadline)
+            return false;
+        fc::usleep(fc::milliseconds(20));
+    }
+    return true;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(p2p_statistics_tests)
+
+BOOST_AUTO_TEST_CASE(peer_connection_counts_received_items)
+{
+    peer_connection_ptr peer = peer_connection::make_shared(nullptr);
+
+    BOOST_CHECK_EQUAL(peer->items_received_from_peer, 0u);
+    BOOST_CHECK_EQUAL(peer->item_fetch_latency_sum.count(), 0);
+    BOOST_CHECK_EQUAL(peer->get_queued_messages_count(), 0u);
+    BOOST_CHECK_EQUAL(peer->get_total_queued_messages_size(), 0u);
+
+    const fc::time_point now = fc::time_point::now();
+    peer->item_received(now - fc::seconds(2));
+    peer->item_received(now - fc::milliseconds(500));
+
+    BOOST_CHECK_EQUAL(peer->items_received_from_peer, 2u);
+    BOOST_CHECK_GE(peer->item_fetch_latency_max.count(), fc::seconds(2).count());
+    BOOST_CHECK_LT(peer->item_fetch_latency_max.count(), fc::milliseconds(2500).count());
+    BOOST_CHECK_GE(peer->item_fetch_latency_sum.count(), fc::milliseconds(2500).count());
+}
+
+BOOST_AUTO_TEST_CASE(node_without_peers)
+{
+    p2p_statistics_tests::p2p_node p2p;
+
+    const node_statistics stats = p2p.node->get_statistics();
+
+    BOOST_CHECK(stats.peers.empty());
+    BOOST_CHECK(!stats.sync.is_syncing);
+    BOOST_CHECK_EQUAL(stats.sync.unfetched_items, 0u);
+    BOOST_CHECK_EQUAL(stats.sync.active_requests, 0u);
+    BOOST_CHECK_EQUAL(stats.sync.items_to_fetch, 0u);
+
+    BOOST_REQUIRE(!stats.delegate_call_histogram_bounds_us.empty());
+    BOOST_REQUIRE(!stats.delegate_calls.empty());
+    for (const delegate_call_statistics& calls : stats.delegate_calls)
+    {
+        BOOST_CHECK(!calls.method.empty());
+        BOOST_CHECK_EQUAL(calls.execution_histogram.size(), stats.delegate_call_histogram_bounds_us.size() + 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(connected_peers_are_reported_by_both_nodes)
+{
+    p2p_statistics_tests::p2p_node server;
+    p2p_statistics_tests::p2p_node client;
+
+    server.node->listen_on_port(0, false);
+    server.node->listen_to_p2p_network();
+    server.node->connect_to_p2p_network();
+
+    client.node->listen_on_port(0, false);
+    client.node->listen_to_p2p_network();
+    client.node->connect_to_p2p_network();
+
+    const fc::ip::endpoint server_endpoint(fc::ip::address("127.0.0.1"),
+                                           server.node->get_actual_listening_endpoint().port());
+    client.node->add_node(server_endpoint);
+    client.node->connect_to_endpoint(server_endpoint);
+
+    BOOST_REQUIRE(p2p_statistics_tests::wait_for([&]() {
+        return server.node->get_statistics().peers.size() == 1u && client.node->get_statistics().peers.size() == 1u;
+    }));
+
+    const node_statistics server_stats = server.node->get_statistics();
+    const node_statistics client_stats = client.node->get_statistics();
+
+    const peer_statistics& client_peer = server_stats.peers[0];
+    const peer_statistics& server_peer = client_stats.peers[0];
+
+    BOOST_CHECK(client_peer.inbound);
+    BOOST_CHECK(!server_peer.inbound);
+    BOOST_CHECK_EQUAL(server_peer.user_agent, "p2p_statistics_tests");
+
+    BOOST_CHECK_GT(client_peer.bytes_sent, 0u);
+    BOOST_CHECK_GT(client_peer.bytes_received, 0u);
+    BOOST_CHECK_GT(server_peer.bytes_sent, 0u);
+    BOOST_CHECK_GT(server_peer.bytes_received, 0u);
+
+    // the peers have not told about any block
+    BOOST_CHECK_EQUAL(client_peer.head_block_number, 0u);
+    BOOST_CHECK_EQUAL(server_peer.head_block_number, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(api_requires_running_p2p_node)
+{
+    scorum::app::application app;
+    scorum::app::api_context ctx(app, "node_metrics_api", std::make_shared<scorum::app::api_session_data>());
+    scorum::app::node_metrics_api api(ctx);
+
+    BOOST_CHECK_THROW(api.get_p2p_statistics(), fc::exception);
+    BOOST_CHECK_EQUAL(api.get_prometheus_metrics().find("scorum_p2p_"), std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,104 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/app/rpc_executor.hpp>
+
+#include <fc/thread/thread.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using scorum::app::rpc_executor;
+
+namespace {
+
+struct concurrency_counter
+{
+    std::atomic<uint32_t> running{ 0 };
+    std::atomic<uint32_t> max_running{ 0 };
+
+    uint32_t call()
+    {
+        const uint32_t now = ++running;
+
+        uint32_t max = max_running;
+        while (now > max && !max_running.compare_exchange_weak(max, now))
+        {
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        --running;
+
+        return now;
+    }
+};
+
+uint32_t run_concurrently(rpc_executor& executor, const std::string& api, concurrency_counter& counter, int calls)
+{
+    std::vector<fc::future<uint32_t>> results;
+    for (int i = 0; i < calls; ++i)
+    {
+        results.push_back(fc::async([&]() {
+            return executor.run<uint32_t>(api, [&counter]() { return counter.call(); });
+        }));
+    }
+
+    for (auto& result : results)
+        result.wait();
+
+    return counter.max_running;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(rpc_executor_tests)
+
+BOOST_AUTO_TEST_CASE(only_configured_apis_are_pooled)
+{
+    rpc_executor executor(1, { { "database_api", 0 } });
+
+    BOOST_CHECK(executor.is_pooled("database_api"));
+    BOOST_CHECK(!executor.is_pooled("login_api"));
+
+    BOOST_CHECK_THROW(executor.run<int>("login_api", []() { return 0; }), fc::exception);
+}
+
+BOOST_AUTO_TEST_CASE(run_on_worker_thread)
+{
+    rpc_executor executor(2, { { "database_api", 0 } });
+
+    const std::thread::id caller = std::this_thread::get_id();
+    const std::thread::id worker
+        = executor.run<std::thread::id>("database_api", []() { return std::this_thread::get_id(); });
+
+    BOOST_CHECK(caller != worker);
+}
+
+BOOST_AUTO_TEST_CASE(exception_is_passed_to_caller)
+{
+    rpc_executor executor(1, { { "database_api", 0 } });
+
+    BOOST_CHECK_THROW(executor.run<int>("database_api",
+                                        []() -> int {
+                                            FC_ASSERT(false, "failed call");
+                                            return 0;
+                                        }),
+                      fc::exception);
+
+    BOOST_CHECK_EQUAL(executor.run<int>("database_api", []() { return 42; }), 42);
+}
+
+BOOST_AUTO_TEST_CASE(calls_of_api_do_not_exceed_limit)
+{
+    rpc_executor executor(4, { { "database_api", 0 }, { "tags_api", 1 } });
+
+    concurrency_counter tags_counter;
+    BOOST_CHECK_EQUAL(run_concurrently(executor, "tags_api", tags_counter, 6), 1u);
+
+    concurrency_counter database_counter;
+    const uint32_t max_running = run_concurrently(executor, "database_api", database_counter, 8);
+    BOOST_CHECK_GT(max_running, 1u);
+    BOOST_CHECK_LE(max_running, 4u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
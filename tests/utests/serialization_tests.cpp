@@ -26,6 +26,8 @@
 #include <scorum/protocol/asset.hpp>
 #include <scorum/protocol/version.hpp>
 
+#include <scorum/app/binary_api.hpp>
+
 #include <fc/io/json.hpp>
 
 #include "defines.hpp"
@@ -221,4 +223,26 @@ SCORUM_TEST_CASE(hardfork_version_test)
     SCORUM_REQUIRE_THROW(fc::from_variant(ver_str, ver), fc::exception);
 }
 
+BOOST_AUTO_TEST_CASE(binary_method_unpacks_params_in_order)
+{
+    std::function<std::map<uint32_t, std::string>(uint32_t, const std::string&)> method
+        = [](uint32_t num, const std::string& name) {
+              std::map<uint32_t, std::string> result;
+              result[num] = name;
+              return result;
+          };
+
+    auto binary_method = scorum::app::make_binary_method(method);
+
+    std::vector<char> params = fc::raw::pack(uint32_t(42));
+    auto name = fc::raw::pack(std::string("alice"));
+    params.insert(params.end(), name.begin(), name.end());
+
+    fc::datastream<const char*> ds(params.data(), params.size());
+    auto result = fc::raw::unpack<std::map<uint32_t, std::string>>(binary_method(ds));
+
+    BOOST_REQUIRE_EQUAL(result.size(), 1u);
+    BOOST_CHECK_EQUAL(result[42], "alice");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
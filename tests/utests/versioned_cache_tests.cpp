@@ -0,0 +1,166 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/app/versioned_cache.hpp>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using scorum::app::versioned_cache;
+using scorum::app::versioned_value;
+
+BOOST_AUTO_TEST_SUITE(versioned_cache_tests)
+
+BOOST_AUTO_TEST_CASE(hit_does_not_build)
+{
+    versioned_cache<std::string, int> cache;
+    int builds = 0;
+
+    BOOST_CHECK_EQUAL(cache.get("alice", 1, [&]() { return ++builds; }), 1);
+    BOOST_CHECK_EQUAL(cache.get("alice", 1, [&]() { return ++builds; }), 1);
+
+    BOOST_CHECK_EQUAL(builds, 1);
+}
+
+BOOST_AUTO_TEST_CASE(miss_builds_every_key)
+{
+    versioned_cache<std::string, std::string> cache;
+    int builds = 0;
+
+    BOOST_CHECK_EQUAL(cache.get("alice", 1, [&]() -> std::string {
+        ++builds;
+        return "a";
+    }), "a");
+    BOOST_CHECK_EQUAL(cache.get("bob", 1, [&]() -> std::string {
+        ++builds;
+        return "b";
+    }), "b");
+    BOOST_CHECK_EQUAL(cache.get("alice", 1, [&]() -> std::string {
+        ++builds;
+        return "x";
+    }), "a");
+
+    BOOST_CHECK_EQUAL(builds, 2);
+}
+
+BOOST_AUTO_TEST_CASE(new_version_drops_all_entries)
+{
+    versioned_cache<std::string, int> cache;
+
+    cache.get("alice", 1, []() { return 1; });
+    cache.get("bob", 1, []() { return 1; });
+
+    BOOST_CHECK_EQUAL(cache.get("alice", 2, []() { return 2; }), 2);
+    BOOST_CHECK_EQUAL(cache.get("bob", 2, []() { return 2; }), 2);
+    BOOST_CHECK_EQUAL(cache.get("alice", 2, []() { return 3; }), 2);
+}
+
+BOOST_AUTO_TEST_CASE(value_built_from_outdated_state_is_not_stored)
+{
+    versioned_cache<std::string, int> cache;
+
+    // the state changes while the entry of the version 1 is being built
+    BOOST_CHECK_EQUAL(cache.get("alice", 1,
+                                [&]() {
+                                    BOOST_CHECK_EQUAL(cache.get("bob", 2, []() { return 2; }), 2);
+                                    return 1;
+                                }),
+                      1);
+
+    BOOST_CHECK_EQUAL(cache.get("alice", 2, []() { return 2; }), 2);
+}
+
+BOOST_AUTO_TEST_CASE(size_is_limited)
+{
+    versioned_cache<int, int> cache(2);
+    int builds = 0;
+
+    for (int key = 0; key < 3; ++key)
+        cache.get(key, 1, [&]() { return ++builds; });
+
+    cache.get(2, 1, [&]() { return ++builds; });
+
+    BOOST_CHECK_EQUAL(builds, 4);
+}
+
+BOOST_AUTO_TEST_CASE(bytes_are_limited)
+{
+    versioned_cache<int, std::string> cache(100, 10, [](const int&, const std::string& value) { return value.size(); });
+    int builds = 0;
+
+    cache.get(1, 1, [&]() {
+        ++builds;
+        return std::string(6, 'a');
+    });
+    cache.get(2, 1, [&]() {
+        ++builds;
+        return std::string(6, 'b');
+    });
+
+    // the first value is kept, the second one does not fit
+    cache.get(1, 1, [&]() {
+        ++builds;
+        return std::string();
+    });
+    BOOST_CHECK_EQUAL(builds, 2);
+
+    BOOST_CHECK_EQUAL(cache.get(2, 1, [&]() { return std::string(++builds, 'b'); }), std::string(3, 'b'));
+
+    // the size is counted from zero for the new version
+    cache.get(2, 2, [&]() {
+        ++builds;
+        return std::string(6, 'b');
+    });
+    cache.get(2, 2, [&]() {
+        ++builds;
+        return std::string();
+    });
+    BOOST_CHECK_EQUAL(builds, 4);
+}
+
+BOOST_AUTO_TEST_CASE(versioned_value_is_rebuilt_for_new_version)
+{
+    versioned_value<int> value;
+
+    BOOST_CHECK_EQUAL(value.get(1, []() { return 1; }), 1);
+    BOOST_CHECK_EQUAL(value.get(1, []() { return 2; }), 1);
+    BOOST_CHECK_EQUAL(value.get(2, []() { return 3; }), 3);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_readers_get_the_same_value)
+{
+    static const int threads_count = 8;
+    static const int calls = 1000;
+
+    versioned_cache<int, int> cache;
+    std::atomic<int> builds{ 0 };
+    std::atomic<int> wrong{ 0 };
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threads_count; ++t)
+    {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < calls; ++i)
+            {
+                const int key = i % 10;
+                const int value = cache.get(key, 1, [&]() {
+                    ++builds;
+                    return key * 100;
+                });
+                if (value != key * 100)
+                    ++wrong;
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    BOOST_CHECK_EQUAL(wrong, 0);
+    // readers of the same state may build an entry at the same time, but not on every call
+    BOOST_CHECK_GE(builds, 10);
+    BOOST_CHECK_LE(builds, 10 * threads_count);
+}
+
+BOOST_AUTO_TEST_SUITE_END()